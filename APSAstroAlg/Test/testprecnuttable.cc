@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+//
+// File:    testprecnuttable.cc
+//
+// Purpose: Test of APSPrecNutTable interpolation error.
+//          Returns 1 if the error is above MAX_ERROR
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <cmath>
+#include <algorithm>
+
+#include "apsprecnuttable.h"
+#include "apsprecnut.h"
+#include "apsastroconst.h"
+#include "apsmathconst.h"
+#include "apsmat3d.h"
+#include "apsvec3d.h"
+
+using aps::apsmathlib::APSMat3d;
+using aps::apsmathlib::APSVec3d;
+using aps::apsastroalg::APSPrecNutTable;
+
+const double MJD_BEGIN  = 58849.0;  // 2020/01/01
+const double MJD_END    = 62867.0;  // 2031/01/01
+const int    SUBSTEPS   = 7;        // Test points between table nodes
+const double MAX_ERROR  = 1.0;      // Microarcseconds
+
+// Largest difference of matrix elements in microarcseconds
+static double MatError( const APSMat3d & Mat1, const APSMat3d & Mat2 )
+{
+  APSVec3d Delta;
+  double   Error = 0.0;
+  int      j;
+
+  for( j = 0; j < 3; j++ ) {
+    Delta = aps::apsmathlib::Col( Mat1, j ) - aps::apsmathlib::Col( Mat2, j );
+
+    Error = std::max( Error, std::fabs( Delta[ aps::apsmathlib::x ] ) );
+    Error = std::max( Error, std::fabs( Delta[ aps::apsmathlib::y ] ) );
+    Error = std::max( Error, std::fabs( Delta[ aps::apsmathlib::z ] ) );
+  }
+
+  return( Error * aps::apsmathlib::Arcs * 1.0e6 );
+}
+
+int main( void )
+{
+  APSPrecNutTable Table( MJD_BEGIN, MJD_END );
+  double          Mjd;
+  double          T;
+  double          MatMaxError = 0.0;
+  double          EquMaxError = 0.0;
+  double          MatMaxMjd   = MJD_BEGIN;
+  double          EquMaxMjd   = MJD_BEGIN;
+  double          Error;
+  int             Number;
+  int             i;
+
+  Number = static_cast<int>( ( MJD_END - MJD_BEGIN ) / APSPrecNutTable :: DEF_STEP ) * SUBSTEPS;
+
+  for( i = 0; i <= Number; i++ ) {
+    Mjd = MJD_BEGIN + ( MJD_END - MJD_BEGIN ) * i / Number;
+    T   = ( Mjd - aps::apsastroalg::MJD_J2000 ) / 36525.0;
+
+    Error = MatError( Table.GetEquToTrueMatrix( Mjd ),
+                      aps::apsastroalg::NutMatrix( T ) * aps::apsastroalg::PrecMatrix_Equ( aps::apsastroalg::T_J2000, T ) );
+
+    if( Error > MatMaxError ) {
+      MatMaxError = Error;
+      MatMaxMjd   = Mjd;
+    }
+
+    Error = std::fabs( Table.GetEquEqu( Mjd ) - aps::apsastroalg::equequ( T ) ) * aps::apsmathlib::Arcs * 1.0e6;
+
+    if( Error > EquMaxError ) {
+      EquMaxError = Error;
+      EquMaxMjd   = Mjd;
+    }
+  }
+
+  std::cout << Number + 1 << " points, MJD " << MJD_BEGIN << " - " << MJD_END <<
+               ", step " << APSPrecNutTable :: DEF_STEP << " d" << std::endl;
+  std::cout << "Matrix max error " << MatMaxError << " uas at MJD " << MatMaxMjd << std::endl;
+  std::cout << "Equation of the equinoxes max error " << EquMaxError << " uas at MJD " << EquMaxMjd << std::endl;
+
+  if( ( MatMaxError > MAX_ERROR ) || ( EquMaxError > MAX_ERROR ) ) {
+    std::cout << "FAILED: error is above " << MAX_ERROR << " uas" << std::endl;
+    return( 1 );
+  }
+
+  std::cout << "OK" << std::endl;
+
+  return( 0 );
+}
+
+//---------------------------- End of file ---------------------------
@@ -8,6 +8,7 @@
 //
 // Initial version 0.1 22.05.2004
 //                 1.0 11.01.2006 apsastorbcalc
+//                 1.1 19.10.2026 APSVec3, APSMat3 in inner loops
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -60,16 +61,18 @@ APSAstOrbIntegFunction :: APSAstOrbIntegFunction( const APSJPLEph * apJPLEph ) :
   GM[ 7 ] = apJPLEph->GetConst( "GM7" );
   GM[ 8 ] = apJPLEph->GetConst( "GM8" );
   GM[ 9 ] = apJPLEph->GetConst( "GM9" );
+
+  EquToEcl = apsmathlib::Mat3R_x( EQU2ECL * apsmathlib::Rad );
 }
 
 APSAstOrbIntegFunction :: ~APSAstOrbIntegFunction( void )
 {
 }
 
-APSVec3d APSAstOrbIntegFunction :: AccelJPL( const double Mjd, const APSVec3d & r ) const
+APSVec3 APSAstOrbIntegFunction :: AccelJPL( const double Mjd, const APSVec3 & r ) const
 {
   int      iPlanet;
-  APSVec3d a, r_p, d;
+  APSVec3  a, r_p, d;
   double   D;
   
   // Solar attraction
@@ -79,9 +82,9 @@ APSVec3d APSAstOrbIntegFunction :: AccelJPL( const double Mjd, const APSVec3d &
   // Planetary perturbation
 
   for ( iPlanet = 1; iPlanet <= 10; iPlanet++ ) {
-    APSVec3d r_planet = pJPLEph->GetPosEph( Mjd, iPlanet, apsastrodata::Sun );
+    APSVec3 r_planet( pJPLEph->GetPosEph( Mjd, iPlanet, apsastrodata::Sun ) );
 
-    r_p = apsmathlib::R_x( EQU2ECL * apsmathlib::Rad ) * r_planet; // From equatorial to ecliptic
+    r_p = EquToEcl * r_planet;
 
     d = r - r_p;
 
@@ -99,8 +102,8 @@ APSVec3d APSAstOrbIntegFunction :: AccelJPL( const double Mjd, const APSVec3d &
 
 void APSAstOrbIntegFunction :: Run( const double X, const double Y[], double dYdX[] ) const
 {
-  APSVec3d r = APSVec3d( Y[ 1 ], Y[ 2 ], Y[ 3 ] );
-  APSVec3d a = AccelJPL( X, r );
+  APSVec3 r( Y[ 1 ], Y[ 2 ], Y[ 3 ] );
+  APSVec3 a = AccelJPL( X, r );
 
   dYdX[0] = 0.0;
   dYdX[1] = Y[ 4 ];  // velocity
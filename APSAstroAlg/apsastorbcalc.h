@@ -8,6 +8,7 @@
 //
 // Initial version 0.1 22.05.2004
 //                 1.0 11.01.2006 apsastorbcalc
+//                 1.1 19.10.2026 APSVec3, APSMat3 in inner loops
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -30,6 +31,7 @@
 
 #include "apsvec3d.h"
 #include "apsmat3d.h"
+#include "apsvec3.h"
 #include "apsabsinteg.h"
 
 namespace aps {
@@ -55,6 +57,8 @@ class APSModuleAstOrbCalc;
 using apslib::APSSubModule;
 using apsmathlib::APSVec3d;
 using apsmathlib::APSMat3d;
+using apsmathlib::APSVec3;
+using apsmathlib::APSMat3;
 using apsmathlib::APSDE;
 using apsmathlib::APSAbsIntegFunction;
 using apsastrodata::APSJPLEph;
@@ -73,8 +77,9 @@ class APSAstOrbIntegFunction : public APSAbsIntegFunction
 
     const APSJPLEph * pJPLEph;
     double            GM[ 11 ];
+    APSMat3           EquToEcl;               // From equatorial to ecliptic
 
-    APSVec3d AccelJPL( const double Mjd, const APSVec3d & r ) const;
+    APSVec3 AccelJPL( const double Mjd, const APSVec3 & r ) const;
 
   public:
 
@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsdeltat.cc
+//
+// Purpose: ET-UT (delta T) on a uniform grid.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 TaiUtc table for ET-UT
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include <map>
+
+#include "apsdeltat.h"
+#include "apstime.h"
+#include "apsastroconst.h"
+#include "apsetutdata.h"
+#include "apstaiutcdata.h"
+
+namespace aps {
+
+  namespace apsastroalg {
+
+//======================= APSDeltaT ==========================
+
+APSDeltaT :: APSDeltaT( const double ET_UT_Default )
+{
+  double DTsec;
+  bool   valid;
+  int    i;
+
+  // Domain of ETminUT: T from -1.75 to 0.05
+  Allocate( MJD_J2000 - 1.75 * 36525.0, MJD_J2000 + 0.05 * 36525.0, BUILT_IN_STEP );
+
+  for( i = 0; i < Number - 1; i++ ) {
+    ETminUT( ( MjdBegin + i * Step - MJD_J2000 ) / 36525.0, DTsec, valid );
+
+    pValues[ i ] = valid ? DTsec : ET_UT_Default;
+  }
+
+  // Last node is after the approximation interval
+  pValues[ Number - 1 ] = ET_UT_Default;
+  pValues[ Number ]     = ET_UT_Default;
+}
+
+APSDeltaT :: APSDeltaT( const APSEtUtData * pAPSEtUtData )
+{
+  const std::map<double,double> & Intervals = pAPSEtUtData->GetIntervals();
+  std::map<double,double>::const_iterator p;
+  std::map<double,double>::const_iterator p_next;
+  double MinStep;
+  double Mjd;
+  int    i;
+
+  if( Intervals.empty() ) {
+    Allocate( MJD_J2000, MJD_J2000, MIN_STEP );
+    pValues[ 0 ] = 0.0;
+    pValues[ 1 ] = 0.0;
+    return;
+  }
+
+  MinStep = MAX_STEP;
+
+  for( p = Intervals.begin(); p != Intervals.end(); ++p ) {
+    p_next = p;
+
+    if( ++p_next != Intervals.end() ) {
+      MinStep = std::min( MinStep, p_next->first - p->first );
+    }
+  }
+
+  Allocate( Intervals.begin()->first, Intervals.rbegin()->first, std::max( MinStep, MIN_STEP ) );
+
+  p = Intervals.begin();
+
+  for( i = 0; i < Number; i++ ) {
+    Mjd = MjdBegin + i * Step;
+
+    p_next = p;
+
+    while( ( ++p_next != Intervals.end() ) && ( p_next->first <= Mjd ) ) {
+      p = p_next;
+    }
+
+    if( p_next == Intervals.end() ) {
+      pValues[ i ] = p->second;
+    }
+    else {
+      pValues[ i ] = p->second + ( Mjd - p->first ) * ( p_next->second - p->second ) / ( p_next->first - p->first );
+    }
+  }
+
+  pValues[ Number ] = pValues[ Number - 1 ];
+}
+
+APSDeltaT :: APSDeltaT( const APSTaiUtcData * pAPSTaiUtcData )
+{
+  const std::map<double,int> & Intervals = pAPSTaiUtcData->GetIntervals();
+  std::map<double,int>::const_iterator p;
+  std::map<double,int>::const_iterator p_next;
+  double Mjd;
+  int    i;
+
+  if( Intervals.empty() ) {
+    Allocate( MJD_J2000, MJD_J2000, MIN_STEP );
+    pValues[ 0 ] = 0.0;
+    pValues[ 1 ] = 0.0;
+    return;
+  }
+
+  // Leap seconds are at 0h UTC, so daily nodes without interpolation are exact
+  Allocate( Intervals.begin()->first, Intervals.rbegin()->first, MIN_STEP );
+  Interp = 0.0;
+
+  p = Intervals.begin();
+
+  for( i = 0; i < Number; i++ ) {
+    Mjd = MjdBegin + i * Step;
+
+    p_next = p;
+
+    while( ( ++p_next != Intervals.end() ) && ( p_next->first <= Mjd ) ) {
+      p = p_next;
+    }
+
+    pValues[ i ] = p->second + ET_MINUS_TAI;
+  }
+
+  pValues[ Number ] = pValues[ Number - 1 ];
+}
+
+APSDeltaT :: ~APSDeltaT( void )
+{
+  delete [] pValues;
+}
+
+void APSDeltaT :: Allocate( const double aMjdBegin, const double MjdEnd, const double aStep )
+{
+  MjdBegin = aMjdBegin;
+  Step     = aStep;
+  InvStep  = 1.0 / Step;
+  Number   = static_cast<int>( ceil( ( MjdEnd - MjdBegin ) / Step ) ) + 1;
+  MaxIndex = Number - 1;
+  Interp   = 1.0;
+
+  // One more node, so that pValues[ i + 1 ] exists for u = MaxIndex
+  pValues = new double[ Number + 1 ];
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
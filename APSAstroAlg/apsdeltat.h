@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsdeltat.h
+//
+// Purpose: ET-UT (delta T) on a uniform grid.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 TaiUtc table for ET-UT
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef APS_DELTA_T_H
+#define APS_DELTA_T_H
+
+#include <algorithm>
+
+namespace aps {
+
+  namespace apsastrodata {
+    class APSEtUtData;
+    class APSTaiUtcData;
+  }
+
+  namespace apsastroalg {
+
+using apsastrodata::APSEtUtData;
+using apsastrodata::APSTaiUtcData;
+
+//======================= APSDeltaT ==========================
+
+/*
+  ET-UT in seconds sampled with a constant step and linearly interpolated.
+  Before the first and after the last node the end values are kept, so
+  the predicted values at the end of an EtUt table are used for the future.
+  TaiUtc table gives ET-UTC, it is kept as steps at the leap seconds.
+  Table is not changed after construction and can be shared by threads.
+*/
+
+class APSDeltaT
+{
+  private:
+
+    static constexpr double BUILT_IN_STEP = 10.0; // Days
+    static constexpr double MIN_STEP      = 1.0;  // Days
+    static constexpr double MAX_STEP      = 30.0; // Days
+
+    double   MjdBegin;
+    double   Step;
+    double   InvStep;
+    double   MaxIndex;
+    double   Interp;   // 1.0 - linear interpolation, 0.0 - steps
+    int      Number;
+    double * pValues;
+
+    void Allocate( const double aMjdBegin, const double MjdEnd, const double aStep );
+
+  public:
+
+    // ETminUT approximation for 1825-2005 and ET_UT_Default after 2005
+    APSDeltaT( const double ET_UT_Default );
+
+    // Values of pAPSEtUtData
+    APSDeltaT( const APSEtUtData * pAPSEtUtData );
+
+    // TAI-UTC of pAPSTaiUtcData + ET-TAI, UT1-UTC is neglected
+    APSDeltaT( const APSTaiUtcData * pAPSTaiUtcData );
+
+    ~APSDeltaT( void );
+
+    double GetETminUT( const double Mjd ) const
+    {
+      double u = std::min( std::max( ( Mjd - MjdBegin ) * InvStep, 0.0 ), MaxIndex );
+      int    i = static_cast<int>( u );
+
+      return( pValues[ i ] + Interp * ( u - i ) * ( pValues[ i + 1 ] - pValues[ i ] ) );
+    }
+
+    double GetMjdBegin( void ) const
+      { return( MjdBegin ); }
+
+    double GetMjdEnd( void ) const
+      { return( MjdBegin + ( Number - 1 ) * Step ); }
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
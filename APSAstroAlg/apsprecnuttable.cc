@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsprecnuttable.cc
+//
+// Purpose: Interpolated precession-nutation matrix and equation of the equinoxes.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "apsprecnuttable.h"
+#include "apsprecnut.h"
+#include "apsastroconst.h"
+#include "apsvec3d.h"
+
+namespace aps {
+
+  namespace apsastroalg {
+
+using apsmathlib::APSVec3d;
+
+//======================= APSPrecNutTable ==========================
+
+APSPrecNutTable :: APSPrecNutTable( const double aMjdBegin, const double aMjdEnd, const double aStep ) :
+                   MjdBegin( aMjdBegin ), MjdEnd( aMjdEnd ), Step( aStep )
+{
+  APSMat3d   Mat;
+  APSVec3d   Column;
+  double   * pValues;
+  int        i;
+  int        j;
+
+  if( MjdEnd < MjdBegin ) {
+    MjdEnd = MjdBegin;
+  }
+
+  // One extra node before MjdBegin and two after MjdEnd
+  Number = static_cast<int>( ceil( ( MjdEnd - MjdBegin ) / Step ) ) + 3;
+
+  pTable = new double[ ELEMENTS * Number ];
+
+  for( i = 0; i < Number; i++ ) {
+    pValues = pTable + ELEMENTS * i;
+
+    Mat = CalcEquToTrueMatrix( MjdBegin + ( i - 1 ) * Step );
+
+    for( j = 0; j < 3; j++ ) {
+      Column = apsmathlib::Col( Mat, j );
+
+      pValues[ j ]     = Column[ apsmathlib::x ];
+      pValues[ 3 + j ] = Column[ apsmathlib::y ];
+      pValues[ 6 + j ] = Column[ apsmathlib::z ];
+    }
+
+    pValues[ 9 ] = CalcEquEqu( MjdBegin + ( i - 1 ) * Step );
+  }
+}
+
+APSPrecNutTable :: ~APSPrecNutTable( void )
+{
+  delete [] pTable;
+}
+
+void APSPrecNutTable :: Interpolate( const double Mjd, double * pValues ) const
+{
+  const double * p0;
+  const double * p1;
+  const double * p2;
+  const double * p3;
+  double         u;
+  double         w0;
+  double         w1;
+  double         w2;
+  double         w3;
+  int            i;
+  int            j;
+
+  u = ( Mjd - MjdBegin ) / Step;
+  i = static_cast<int>( floor( u ) );
+
+  if( i > Number - 4 ) {
+    i = Number - 4;
+  }
+
+  u = u - i;
+
+  // Nodes i - 1, i, i + 1, i + 2 of the interval are table rows i .. i + 3
+  w0 = -u * ( u - 1.0 ) * ( u - 2.0 ) / 6.0;
+  w1 = ( u + 1.0 ) * ( u - 1.0 ) * ( u - 2.0 ) / 2.0;
+  w2 = -( u + 1.0 ) * u * ( u - 2.0 ) / 2.0;
+  w3 = ( u + 1.0 ) * u * ( u - 1.0 ) / 6.0;
+
+  p0 = pTable + ELEMENTS * i;
+  p1 = p0 + ELEMENTS;
+  p2 = p1 + ELEMENTS;
+  p3 = p2 + ELEMENTS;
+
+  for( j = 0; j < ELEMENTS; j++ ) {
+    pValues[ j ] = w0 * p0[ j ] + w1 * p1[ j ] + w2 * p2[ j ] + w3 * p3[ j ];
+  }
+}
+
+APSMat3d APSPrecNutTable :: GetEquToTrueMatrix( const double Mjd ) const
+{
+  double Values[ ELEMENTS ];
+
+  if( !IfCovered( Mjd ) ) {
+    return( CalcEquToTrueMatrix( Mjd ) );
+  }
+
+  Interpolate( Mjd, Values );
+
+  return( APSMat3d( APSVec3d( Values[ 0 ], Values[ 3 ], Values[ 6 ] ),
+                    APSVec3d( Values[ 1 ], Values[ 4 ], Values[ 7 ] ),
+                    APSVec3d( Values[ 2 ], Values[ 5 ], Values[ 8 ] ) ) );
+}
+
+double APSPrecNutTable :: GetEquEqu( const double Mjd ) const
+{
+  double Values[ ELEMENTS ];
+
+  if( !IfCovered( Mjd ) ) {
+    return( CalcEquEqu( Mjd ) );
+  }
+
+  Interpolate( Mjd, Values );
+
+  return( Values[ 9 ] );
+}
+
+APSMat3d APSPrecNutTable :: CalcEquToTrueMatrix( const double Mjd )
+{
+  double T = ( Mjd - MJD_J2000 ) / 36525.0;
+
+  return( NutMatrix( T ) * PrecMatrix_Equ( T_J2000, T ) );
+}
+
+double APSPrecNutTable :: CalcEquEqu( const double Mjd )
+{
+  return( equequ( ( Mjd - MJD_J2000 ) / 36525.0 ) );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,87 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsprecnuttable.h
+//
+// Purpose: Interpolated precession-nutation matrix and equation of the equinoxes.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef APS_PRECNUT_TABLE_H
+#define APS_PRECNUT_TABLE_H
+
+#include "apsmat3d.h"
+
+namespace aps {
+
+  namespace apsastroalg {
+
+using apsmathlib::APSMat3d;
+
+//======================= APSPrecNutTable ==========================
+
+/*
+  NutMatrix( T ) * PrecMatrix_Equ( T_J2000, T ) and equequ( T ) sampled with
+  step Step over [MjdBegin, MjdEnd] and interpolated by cubic Lagrange
+  polynomials. Outside the interval values are calculated directly.
+  Table is not changed after construction and can be shared by threads.
+*/
+
+class APSPrecNutTable
+{
+  private:
+
+    static const int ELEMENTS = 10;   // 9 matrix elements and equation of the equinoxes
+
+    double   MjdBegin;
+    double   MjdEnd;
+    double   Step;
+    int      Number;
+    double * pTable;
+
+    void Interpolate( const double Mjd, double * pValues ) const;
+
+  public:
+
+    static constexpr double DEF_STEP = 0.125; // Days
+
+    APSPrecNutTable( const double aMjdBegin, const double aMjdEnd, const double aStep = DEF_STEP );
+
+    ~APSPrecNutTable( void );
+
+    // Mean equator and equinox of J2000 -> true equator and equinox of date
+    APSMat3d GetEquToTrueMatrix( const double Mjd ) const;
+
+    // Equation of the equinoxes in radians
+    double GetEquEqu( const double Mjd ) const;
+
+    int IfCovered( const double Mjd ) const
+      { return( ( Mjd >= MjdBegin ) && ( Mjd <= MjdEnd ) ); }
+
+    static APSMat3d CalcEquToTrueMatrix( const double Mjd );
+
+    static double CalcEquEqu( const double Mjd );
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,142 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsbodyeph.cc
+//
+// Purpose: Chebyshev approximations of Sun, Moon and Earth positions.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 GetPos checks the segment time
+//         version 0.3 19.10.2026 Fallback uses APSJPLEph of the caller
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+
+#include <cmath>
+
+#include "apsbodyeph.h"
+#include "apsjpleph.h"
+#include "apsabschebmaker.h"
+
+namespace aps {
+
+  namespace apsastrodata {
+
+using apsmathlib::APSAbsChebMaker;
+
+// In order of APSBodyEph :: BodyType
+static const int BodyTargets[] = { Sun, Moon, Earth };
+static const int BodyCenters[] = { Earth, Earth, Barycenter };
+
+//======================= APSBodyChebMaker ==========================
+
+class APSBodyChebMaker : public APSAbsChebMaker
+{
+  private:
+
+    const APSJPLEph * pEph;
+    int               Target;
+    int               Center;
+
+  protected:
+
+    virtual APSVec3d GetValue( const double t )
+      { return( pEph->GetPosEph( t, Target, Center ) ); }
+
+  public:
+
+    APSBodyChebMaker( const APSJPLEph * apEph, const int aTarget, const int aCenter ) :
+      pEph( apEph ), Target( aTarget ), Center( aCenter )
+      {}
+};
+
+//======================= APSBodyEph ==========================
+
+APSBodyEph :: APSBodyEph( const APSJPLEph * apEph, const double aMjdBegin, const double aMjdEnd,
+                          const double aStep ) :
+                MjdBegin( aMjdBegin ), Step( aStep )
+{
+  double cX[ ORDER + 1 ];
+  double cY[ ORDER + 1 ];
+  double cZ[ ORDER + 1 ];
+  double ta;
+  int    Body;
+  int    i;
+
+  Number = static_cast<int>( ceil( ( aMjdEnd - MjdBegin ) / Step ) );
+
+  if( Number < 1 ) {
+    Number = 1;
+  }
+
+  MjdEnd = MjdBegin + Number * Step;
+
+  pSegments = new BodyCheb[ BODIES_NUMBER * Number ];
+
+  for( Body = 0; Body < BODIES_NUMBER; Body++ ) {
+    APSBodyChebMaker Maker( apEph, BodyTargets[ Body ], BodyCenters[ Body ] );
+
+    for( i = 0; i < Number; i++ ) {
+      ta = MjdBegin + i * Step;
+
+      Maker.Create( ORDER, ta, ta + Step, cX, cY, cZ );
+
+      pSegments[ Body * Number + i ].Set( ORDER, cX, cY, cZ, ta, ta + Step );
+    }
+  }
+}
+
+APSBodyEph :: ~APSBodyEph( void )
+{
+  delete [] pSegments;
+}
+
+APSVec3d APSBodyEph :: GetPos( const APSJPLEph * apEph, const int Body, const double Mjd ) const
+{
+  APSVec3d Pos;
+  int      i;
+
+  if( !IfCovered( Mjd ) ) {
+    return( apEph->GetPosEph( Mjd, BodyTargets[ Body ], BodyCenters[ Body ] ) );
+  }
+
+  i = static_cast<int>( ( Mjd - MjdBegin ) / Step );
+
+  if( i >= Number ) {
+    i = Number - 1;
+  }
+
+  if( !pSegments[ Body * Number + i ].Value( Mjd, Pos ) ) {
+    return( Pos );
+  }
+
+  // Rounding of the index can select the neighbouring segment
+  if( ( i > 0 ) && !pSegments[ Body * Number + i - 1 ].Value( Mjd, Pos ) ) {
+    return( Pos );
+  }
+
+  if( ( i < Number - 1 ) && !pSegments[ Body * Number + i + 1 ].Value( Mjd, Pos ) ) {
+    return( Pos );
+  }
+
+  return( apEph->GetPosEph( Mjd, BodyTargets[ Body ], BodyCenters[ Body ] ) );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
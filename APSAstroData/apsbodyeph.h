@@ -0,0 +1,105 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsbodyeph.h
+//
+// Purpose: Chebyshev approximations of Sun, Moon and Earth positions.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Fallback uses APSJPLEph of the caller
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+
+#ifndef APS_BODY_EPH_H
+#define APS_BODY_EPH_H
+
+#include "apschebeval.h"
+#include "apsvec3d.h"
+
+namespace aps {
+
+  namespace apsastrodata {
+
+using apsmathlib::APSChebEval;
+using apsmathlib::APSVec3d;
+
+class APSJPLEph;
+
+//======================= APSBodyEph ==========================
+
+/*
+  Geocentric Sun and Moon and barycentric Earth positions of APSJPLEph
+  approximated by Chebyshev segments of constant length over [MjdBegin, MjdEnd].
+  Outside the interval values are taken from apEph given by the caller. Positions
+  are the same as of APSJPLEph :: SunEquPos, MoonEquPos and EarthBaryEquPos.
+  Segments are not changed after construction and can be shared by threads,
+  each thread must pass its own APSJPLEph because APSJPLEph is not thread-safe.
+*/
+
+class APSBodyEph
+{
+  public:
+
+    static const int        ORDER    = 13;
+    static constexpr double DEF_STEP = 4.0; // Days
+
+  private:
+
+    enum BodyType {
+      BODY_SUN = 0,
+      BODY_MOON,
+      BODY_EARTH_BARY,
+      BODIES_NUMBER
+    };
+
+    typedef APSChebEval<ORDER> BodyCheb;
+
+    double            MjdBegin;
+    double            MjdEnd;
+    double            Step;
+    int               Number;
+    BodyCheb        * pSegments;
+
+    APSVec3d GetPos( const APSJPLEph * apEph, const int Body, const double Mjd ) const;
+
+  public:
+
+    APSBodyEph( const APSJPLEph * apEph, const double aMjdBegin, const double aMjdEnd,
+                const double aStep = DEF_STEP );
+
+    ~APSBodyEph( void );
+
+    int IfCovered( const double Mjd ) const
+      { return( ( Mjd >= MjdBegin ) && ( Mjd <= MjdEnd ) ); }
+
+    APSVec3d SunEquPos( const APSJPLEph * apEph, const double Mjd ) const
+      { return( GetPos( apEph, BODY_SUN, Mjd ) ); }
+
+    APSVec3d MoonEquPos( const APSJPLEph * apEph, const double Mjd ) const
+      { return( GetPos( apEph, BODY_MOON, Mjd ) ); }
+
+    APSVec3d EarthBaryEquPos( const APSJPLEph * apEph, const double Mjd ) const
+      { return( GetPos( apEph, BODY_EARTH_BARY, Mjd ) ); }
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -9,6 +9,7 @@
 //
 // Initial version 0.1 30.01.2004
 //         version 0.2 26.05.2004 GoToRecord procedure has been added
+//         version 0.3 19.10.2026 GetRecordLength was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -51,6 +52,9 @@ class AstOrbReader : protected APSIStrAstroIO
 
     int GetAsteroidsNumber( off_t & AsteroidsNumber );
 
+    int GetRecordLength( void ) const
+      { return( RecordLength ); }
+
     int GetAsteroidID( int & pAsteroidID ) const;
 
     int GetAsteroidName( std::string & pAsteroidName ) const;
@@ -0,0 +1,70 @@
+//------------------------------------------------------------------------------
+//
+// File:    apshash.cc
+//
+// Purpose: 64 bit hash and checksum of memory blocks.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <string.h>
+
+#include "apshash.h"
+
+namespace aps {
+
+  namespace apslib {
+
+const uint64_t APS_HASH_PRIME     = 1099511628211ULL;
+const uint64_t APS_CHECKSUM_PRIME = 0x9E3779B97F4A7C15ULL;
+
+uint64_t APSHash( const void * pData, const size_t Length, const uint64_t Hash )
+{
+  const unsigned char * p      = static_cast<const unsigned char *>( pData );
+  uint64_t              Result = Hash;
+  size_t                i;
+
+  for( i = 0; i < Length; i++ ) {
+    Result = ( Result ^ p[ i ] ) * APS_HASH_PRIME;
+  }
+
+  return( Result );
+}
+
+uint64_t APSChecksum( const void * pData, const size_t Length )
+{
+  const unsigned char * p      = static_cast<const unsigned char *>( pData );
+  uint64_t              Result = APS_HASH_INIT ^ Length;
+  uint64_t              Word;
+  size_t                i;
+
+  for( i = 0; i + sizeof( Word ) <= Length; i += sizeof( Word ) ) {
+    memcpy( &Word, p + i, sizeof( Word ) );
+
+    Result = ( Result ^ Word ) * APS_CHECKSUM_PRIME;
+    Result = Result ^ ( Result >> 29 );
+  }
+
+  return( APSHash( p + i, Length - i, Result ) );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+//
+// File:    apshash.h
+//
+// Purpose: 64 bit hash and checksum of memory blocks.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef 	_APSHASH_H_
+#define         _APSHASH_H_	1
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace aps {
+
+  namespace apslib {
+
+const uint64_t APS_HASH_INIT = 14695981039346656037ULL;
+
+/* FNV-1a hash of Length bytes, Hash of the previous block may be passed to continue it */
+uint64_t APSHash( const void * pData, const size_t Length, const uint64_t Hash = APS_HASH_INIT );
+
+/* Fast checksum of a large block, 8 bytes per step */
+uint64_t APSChecksum( const void * pData, const size_t Length );
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
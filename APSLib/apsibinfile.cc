@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 30.04.2004
+//         version 0.2 19.10.2026 GetRecord takes size_t, long records are read in chunks
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -24,12 +25,16 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "apsibinfile.h"
 
 namespace aps {
 
   namespace apslib {
 
+const size_t MAX_CHUNK_LENGTH = 0x40000000; // 1 GiB, longest single read
+
 APSIBinFile :: APSIBinFile( const std::string & aFileName ) :
 APSIFile( aFileName, std::ios::in | std::ios::binary )
 {
@@ -39,17 +44,27 @@ APSIBinFile :: ~APSIBinFile( void )
 {
 }
 
-bool APSIBinFile :: GetRecord( void * pRecord, const unsigned int RecordLength )
+bool APSIBinFile :: GetRecord( void * pRecord, const size_t RecordLength )
 {
-  if( IfOpened() ) {
-    GetFile().read( static_cast<char *>( pRecord ), RecordLength );
+  char   * pData  = static_cast<char *>( pRecord );
+  size_t   Length = RecordLength;
+  size_t   ChunkLength;
+
+  if( !IfOpened() ) {
+    return( false );
+  }
+
+  while( Length ) {
+    ChunkLength = std::min( Length, MAX_CHUNK_LENGTH );
+
+    GetFile().read( pData, ChunkLength );
 
     if( !GetFile() ) {
       return( false );
     }
-  }
-  else {
-    return( false );
+
+    pData  += ChunkLength;
+    Length -= ChunkLength;
   }
 
   return( true );
@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 30.04.2004
+//         version 0.2 19.10.2026 GetRecord takes size_t, long records are read in chunks
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -29,6 +30,7 @@
 
 #include <fstream>
 #include <string>
+#include <cstddef>
 
 #include "apsifile.h"
 
@@ -44,7 +46,8 @@ class APSIBinFile : public APSIFile
 
     virtual ~APSIBinFile( void );
 
-    bool GetRecord( void * pRecord, const unsigned int RecordLength );
+    /* Records longer than 1 GiB are read in chunks */
+    bool GetRecord( void * pRecord, const size_t RecordLength );
 };
 
 }}
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsimmapfile.cc
+//
+// Purpose: Read only memory mapped file
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "apsimmapfile.h"
+
+namespace aps {
+
+  namespace apslib {
+
+APSIMMapFile :: APSIMMapFile( const std::string & aFileName ) :
+                FileName( aFileName ), pData( 0 ), Length( 0 )
+{
+}
+
+APSIMMapFile :: ~APSIMMapFile( void )
+{
+  if( IfOpened() ) {
+    Close();
+  }
+}
+
+bool APSIMMapFile :: Open( void )
+{
+  struct stat statBuffer;
+  void      * pMap;
+  int         fd;
+
+  if( IfOpened() ) {
+    return( false );
+  }
+
+  fd = open( FileName.c_str(), O_RDONLY );
+
+  if( fd == -1 ) {
+    return( false );
+  }
+
+  if( ( fstat( fd, &statBuffer ) == -1 ) || ( statBuffer.st_size <= 0 ) ) {
+    close( fd );
+    return( false );
+  }
+
+  pMap = mmap( 0, statBuffer.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+  close( fd );
+
+  if( pMap == MAP_FAILED ) {
+    return( false );
+  }
+
+  pData  = static_cast<const char *>( pMap );
+  Length = statBuffer.st_size;
+
+  return( true );
+}
+
+bool APSIMMapFile :: Close( void )
+{
+  if( IfOpened() ) {
+    munmap( const_cast<char *>( pData ), Length );
+
+    pData  = 0;
+    Length = 0;
+
+    return( true );
+  }
+
+  return( false );
+}
+
+const char * APSIMMapFile :: GetRecord( const size_t Offset, const size_t RecordLength ) const
+{
+  if( IfOpened() && ( Offset <= Length ) && ( RecordLength <= Length - Offset ) ) {
+    return( pData + Offset );
+  }
+
+  return( 0 );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
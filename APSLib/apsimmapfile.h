@@ -0,0 +1,77 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsimmapfile.h
+//
+// Purpose: Read only memory mapped file
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef 	_APSIMMAPFILE_H_
+#define         _APSIMMAPFILE_H_	1
+
+#include <string>
+
+#include <sys/types.h>
+
+namespace aps {
+
+  namespace apslib {
+
+class APSIMMapFile
+{
+  private:
+
+    std::string  FileName;
+    const char * pData;
+    size_t       Length;
+
+  public:
+
+    APSIMMapFile( const std::string & aFileName );
+
+    virtual ~APSIMMapFile( void );
+
+    const std::string & GetFileName( void ) const
+      { return( FileName ); }
+
+    bool IfOpened( void ) const
+      { return( pData != 0 ); }
+
+    bool Open( void );
+
+    bool Close( void );
+
+    /* start of the mapped file, 0 if file is not opened */
+    const char * GetData( void ) const
+      { return( pData ); }
+
+    size_t GetLength( void ) const
+      { return( Length ); }
+
+    /* pointer to Offset if RecordLength bytes are inside the file, otherwise 0 */
+    const char * GetRecord( const size_t Offset, const size_t RecordLength ) const;
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -8,6 +8,7 @@
 //
 // Initial version 0.1 30.04.2004
 //         version 0.2 12.02.2005 PutRecord was corrected
+//         version 0.3 19.10.2026 PutRecord takes size_t, long records are written in chunks
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -25,12 +26,16 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include "apsobinfile.h"
 
 namespace aps {
 
   namespace apslib {
 
+const size_t MAX_CHUNK_LENGTH = 0x40000000; // 1 GiB, longest single write
+
 APSOBinFile :: APSOBinFile( const std::string & aFileName ) :
 APSOFile( aFileName, std::ios::out | std::ios::binary )
 {
@@ -45,17 +50,27 @@ APSOBinFile :: ~APSOBinFile( void )
 {
 }
 
-bool APSOBinFile :: PutRecord( const void * pRecord, const unsigned int RecordLength )
+bool APSOBinFile :: PutRecord( const void * pRecord, const size_t RecordLength )
 {
- if( IfOpened() ) {
-    GetFile().write( static_cast<const char *>( pRecord ), RecordLength );
+  const char * pData  = static_cast<const char *>( pRecord );
+  size_t       Length = RecordLength;
+  size_t       ChunkLength;
+
+  if( !IfOpened() ) {
+    return( false );
+  }
+
+  while( Length ) {
+    ChunkLength = std::min( Length, MAX_CHUNK_LENGTH );
+
+    GetFile().write( pData, ChunkLength );
 
     if( !GetFile() ) {
       return( false );
     }
-  }
-  else {
-    return( false );
+
+    pData  += ChunkLength;
+    Length -= ChunkLength;
   }
 
   return( true );
@@ -8,6 +8,7 @@
 //
 // Initial version 0.1 30.04.2004
 //         version 0.2 12.02.2005 PutRecord was corrected
+//         version 0.3 19.10.2026 PutRecord takes size_t, long records are written in chunks
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -29,6 +30,7 @@
 #define  _APSOBINFILE_H_ 1
 
 #include <string>
+#include <cstddef>
 
 #include "apsofile.h"
 
@@ -46,7 +48,8 @@ class APSOBinFile : public APSOFile
 
     virtual ~APSOBinFile( void );
 
-    bool PutRecord( const void * pRecord, const unsigned int RecordLength );
+    /* Records longer than 1 GiB are written in chunks */
+    bool PutRecord( const void * pRecord, const size_t RecordLength );
 };
 
 }}
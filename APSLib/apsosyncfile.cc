@@ -0,0 +1,150 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsosyncfile.cc
+//
+// Purpose: Output file written directly to the descriptor, it can be synchronized with the disk
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Truncate was added
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "apsosyncfile.h"
+
+namespace aps {
+
+  namespace apslib {
+
+APSOSyncFile :: APSOSyncFile( const std::string & aFileName ) :
+                FileName( aFileName ), fd( -1 ), Position( 0 )
+{
+}
+
+APSOSyncFile :: ~APSOSyncFile( void )
+{
+  if( IfOpened() ) {
+    Close();
+  }
+}
+
+bool APSOSyncFile :: Open( const bool Append )
+{
+  if( IfOpened() ) {
+    return( false );
+  }
+
+  fd = open( FileName.c_str(), O_WRONLY | O_CREAT | ( Append ? 0 : O_TRUNC ), 0644 );
+
+  if( fd == -1 ) {
+    return( false );
+  }
+
+  Position = lseek( fd, 0, SEEK_END );
+
+  if( Position == -1 ) {
+    close( fd );
+    fd       = -1;
+    Position = 0;
+    return( false );
+  }
+
+  return( true );
+}
+
+bool APSOSyncFile :: Close( void )
+{
+  bool RetCode;
+
+  if( !IfOpened() ) {
+    return( false );
+  }
+
+  RetCode = ( close( fd ) == 0 );
+
+  fd       = -1;
+  Position = 0;
+
+  return( RetCode );
+}
+
+bool APSOSyncFile :: PutRecord( const void * pRecord, const size_t RecordLength )
+{
+  const char * pData = static_cast<const char *>( pRecord );
+  size_t       Length = RecordLength;
+  ssize_t      Written;
+
+  if( !IfOpened() ) {
+    return( false );
+  }
+
+  while( Length ) {
+    Written = write( fd, pData, Length );
+
+    if( Written == -1 ) {
+      if( errno == EINTR ) {
+        continue;
+      }
+
+      return( false );
+    }
+
+    pData    += Written;
+    Length   -= Written;
+    Position += Written;
+  }
+
+  return( true );
+}
+
+bool APSOSyncFile :: Sync( void )
+{
+  if( !IfOpened() ) {
+    return( false );
+  }
+
+  return( fsync( fd ) == 0 );
+}
+
+bool APSOSyncFile :: Truncate( const off_t Length )
+{
+  if( !IfOpened() ) {
+    return( false );
+  }
+
+  if( ftruncate( fd, Length ) == -1 ) {
+    return( false );
+  }
+
+  if( lseek( fd, Length, SEEK_SET ) == -1 ) {
+    return( false );
+  }
+
+  Position = Length;
+
+  return( true );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
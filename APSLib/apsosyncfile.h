@@ -0,0 +1,81 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsosyncfile.h
+//
+// Purpose: Output file written directly to the descriptor, it can be synchronized with the disk
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Truncate was added
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef 	_APSOSYNCFILE_H_
+#define         _APSOSYNCFILE_H_	1
+
+#include <string>
+
+#include <sys/types.h>
+
+namespace aps {
+
+  namespace apslib {
+
+class APSOSyncFile
+{
+  private:
+
+    std::string FileName;
+    int         fd;
+    off_t       Position;
+
+  public:
+
+    APSOSyncFile( const std::string & aFileName );
+
+    virtual ~APSOSyncFile( void );
+
+    const std::string & GetFileName( void ) const
+      { return( FileName ); }
+
+    bool IfOpened( void ) const
+      { return( fd != -1 ); }
+
+    /* existing file is truncated unless Append is set */
+    bool Open( const bool Append = false );
+
+    bool Close( void );
+
+    off_t Pos( void ) const
+      { return( Position ); }
+
+    /* record is passed to the system at once, it survives the program crash */
+    bool PutRecord( const void * pRecord, const size_t RecordLength );
+
+    /* waits until written data are on the disk */
+    bool Sync( void );
+
+    /* file is cut to Length bytes, next record is written there */
+    bool Truncate( const off_t Length );
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
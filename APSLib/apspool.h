@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------------
+//
+// File:    apspool.h
+//
+// Purpose: Pool allocator for objects released together
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef 	_APSPOOL_H_
+#define         _APSPOOL_H_	1
+
+#include <new>
+#include <vector>
+
+namespace aps {
+
+  namespace apslib {
+
+/*
+  Objects are constructed in place in blocks of BlockSize elements:
+
+    pObject = new ( Pool.Allocate() ) T( ... );
+
+  and destroyed all together by Clear or pool destructor.
+*/
+
+template<class T> class APSPool
+{
+  private:
+
+    std::vector<T *> Blocks;
+    unsigned int     BlockSize;
+    unsigned int     LastBlockNumber;  /* objects in the last block */
+    unsigned int     ObjectsNumber;
+
+    APSPool( const APSPool & );
+
+    APSPool & operator = ( const APSPool & );
+
+  public:
+
+    APSPool( const unsigned int aBlockSize = 4096 ) :
+      BlockSize( aBlockSize ), LastBlockNumber( aBlockSize ), ObjectsNumber( 0 )
+      {}
+
+    ~APSPool( void )
+      { Clear(); }
+
+    void * Allocate( void );
+
+    void Clear( void );
+
+    unsigned int GetObjectsNumber( void ) const
+      { return( ObjectsNumber ); }
+
+    unsigned int GetBlocksNumber( void ) const
+      { return( Blocks.size() ); }
+};
+
+template<class T> void * APSPool<T> :: Allocate( void )
+{
+  if( LastBlockNumber == BlockSize ) {
+    Blocks.push_back( static_cast<T *>( ::operator new( BlockSize * sizeof( T ) ) ) );
+
+    LastBlockNumber = 0;
+  }
+
+  ObjectsNumber++;
+
+  return( Blocks.back() + LastBlockNumber++ );
+}
+
+template<class T> void APSPool<T> :: Clear( void )
+{
+  unsigned int i;
+  unsigned int j;
+  unsigned int Number;
+
+  for( i = 0; i < Blocks.size(); i++ ) {
+    Number = ( i + 1 < Blocks.size() ) ? BlockSize : LastBlockNumber;
+
+    for( j = 0; j < Number; j++ ) {
+      Blocks[ i ][ j ].~T();
+    }
+
+    ::operator delete( Blocks[ i ] );
+  }
+
+  Blocks.clear();
+
+  LastBlockNumber = BlockSize;
+  ObjectsNumber   = 0;
+}
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 17.05.2004
+//         version 0.2 19.10.2026 GetTailError and CreateAdaptive were added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -100,6 +101,87 @@ int APSAbsChebMaker :: Create( const unsigned int Order, const double ta, const
   return( RetCode );
 }
 
+double APSAbsChebMaker :: GetTailError( const unsigned int Order, const double cX[], const double cY[], const double cZ[] )
+{
+  double Error;
+  double Tmp;
+
+  if( Order < 1 ) {
+    return( fabs( cX[ 0 ] ) + fabs( cY[ 0 ] ) + fabs( cZ[ 0 ] ) );
+  }
+
+  Error = fabs( cX[ Order - 1 ] ) + fabs( cX[ Order ] );
+
+  Tmp = fabs( cY[ Order - 1 ] ) + fabs( cY[ Order ] );
+
+  if( Tmp > Error ) {
+    Error = Tmp;
+  }
+
+  Tmp = fabs( cZ[ Order - 1 ] ) + fabs( cZ[ Order ] );
+
+  if( Tmp > Error ) {
+    Error = Tmp;
+  }
+
+  return( Error );
+}
+
+int APSAbsChebMaker :: CreateAdaptive( const double ta, const double MinLength, const double MaxLength,
+                                       const double Tolerance, const unsigned int MaxOrder,
+                                       unsigned int & Order, double & Length, double & NextLength,
+                                       double cX[], double cY[], double cZ[] )
+{
+  double Error;
+  int    RetCode;
+
+  RetCode = 0;
+  Error   = 0.0;
+
+  if( Length > MaxLength ) {
+    Length = MaxLength;
+  }
+
+  if( Length < MinLength ) {
+    Length = MinLength;
+  }
+
+  for( ;; ) {
+    RetCode = Create( Order, ta, ta + Length, cX, cY, cZ );
+
+    if( RetCode ) {
+      break;
+    }
+
+    Error = GetTailError( Order, cX, cY, cZ );
+
+    if( Error <= Tolerance ) {
+      break;
+    }
+
+    if( Length / 2.0 >= MinLength ) {
+      Length = Length / 2.0;
+    }
+    else if( Order + 2 <= MaxOrder ) {
+      Order = Order + 2;
+    }
+    else {
+      RetCode = 1;
+      break;
+    }
+  }
+
+  // Length is doubled only with a clear margin, a failed guess costs one more Create
+  if( !RetCode && ( Error * 16.0 < Tolerance ) ) {
+    NextLength = 2.0 * Length;
+  }
+  else {
+    NextLength = Length;
+  }
+
+  return( RetCode );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
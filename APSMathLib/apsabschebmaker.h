@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 17.05.2004
+//         version 0.2 19.10.2026 GetTailError and CreateAdaptive were added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -50,6 +51,21 @@ class APSAbsChebMaker
 
     int Create( const unsigned int Order, const double ta, const double tb,
                 double cX[], double cY[], double cZ[] );
+
+    /* Largest of the last two coefficients of x, y and z */
+    static double GetTailError( const unsigned int Order, const double cX[], const double cY[], const double cZ[] );
+
+    /*
+      Creates approximation beginning at ta with GetTailError not greater than Tolerance.
+      Length is halved down to MinLength and then Order is increased by 2 up to MaxOrder
+      until Tolerance is met. Length is the initial guess on input and the length used on
+      output. NextLength is a guess for the next segment. Arrays must hold MaxOrder + 1
+      coefficients. Returns 1 if Tolerance could not be met.
+    */
+    int CreateAdaptive( const double ta, const double MinLength, const double MaxLength,
+                        const double Tolerance, const unsigned int MaxOrder,
+                        unsigned int & Order, double & Length, double & NextLength,
+                        double cX[], double cY[], double cZ[] );
 };
 
 }}
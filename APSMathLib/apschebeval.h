@@ -0,0 +1,237 @@
+//------------------------------------------------------------------------------
+//
+// File:    apschebeval.h
+//
+// Purpose: Fixed order three dimensional Chebyshev evaluator.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef APS_CHEB_EVAL_H
+#define APS_CHEB_EVAL_H
+
+#include "apsmodulecheb.h"
+#include "apsvec3d.h"
+
+namespace aps {
+
+  namespace apsmathlib {
+
+//======================= APSChebEval ==========================
+
+/*
+  Stack resident replacement of APSCheb. Coefficients of x, y and z are
+  interleaved and the Clenshaw loop length is the template parameter.
+  Approximations of lower order are padded with zero coefficients, which
+  does not change results. Values are the same as of APSCheb :: Value.
+  Nothing is allocated and no messages are issued, functions return
+  APS_MODULE_CHEB_* codes.
+*/
+
+template<int Order>
+class APSChebEval
+{
+  private:
+
+    double c[ Order + 1 ][ 3 ];
+    double ta;
+    double tb;
+    int    RetCode;
+
+    void Clenshaw( const double t, double * pPos, double * pVel ) const;
+
+  public:
+
+    APSChebEval( void ) : ta( 0.0 ), tb( 0.0 ), RetCode( APS_MODULE_CHEB_ORDER )
+      {}
+
+    APSChebEval( const int aOrder, const double * acX, const double * acY, const double * acZ,
+                 const double ata, const double atb )
+      { Set( aOrder, acX, acY, acZ, ata, atb ); }
+
+    /* Returns APS_MODULE_CHEB_ORDER if aOrder is greater than Order */
+    int Set( const int aOrder, const double * acX, const double * acY, const double * acZ,
+             const double ata, const double atb );
+
+    int Value( const double t, double * pPos ) const;
+
+    /* Velocity is in units of position per unit of t */
+    int Value( const double t, double * pPos, double * pVel ) const;
+
+    int Value( const double t, APSVec3d & Val ) const;
+
+    /* Positions and optional velocities for Number times, 3 values per time.
+       Stops at the first time out of interval. */
+    int Values( const double * pT, const int Number, double * pPos, double * pVel = 0 ) const;
+
+    double Getta( void ) const
+      { return( ta ); }
+
+    double Gettb( void ) const
+      { return( tb ); }
+};
+
+template<int Order>
+int APSChebEval<Order> :: Set( const int aOrder, const double * acX, const double * acY, const double * acZ,
+                               const double ata, const double atb )
+{
+  int i;
+
+  ta = ata;
+  tb = atb;
+
+  if( ( aOrder < 0 ) || ( aOrder > Order ) ) {
+    RetCode = APS_MODULE_CHEB_ORDER;
+    return( RetCode );
+  }
+
+  for( i = 0; i <= aOrder; i++ ) {
+    c[ i ][ 0 ] = acX[ i ];
+    c[ i ][ 1 ] = acY[ i ];
+    c[ i ][ 2 ] = acZ[ i ];
+  }
+
+  for( ; i <= Order; i++ ) {
+    c[ i ][ 0 ] = 0.0;
+    c[ i ][ 1 ] = 0.0;
+    c[ i ][ 2 ] = 0.0;
+  }
+
+  RetCode = APS_MODULE_CHEB_NO_ERROR;
+
+  return( RetCode );
+}
+
+template<int Order>
+void APSChebEval<Order> :: Clenshaw( const double t, double * pPos, double * pVel ) const
+{
+  double tau;
+  double tau2;
+  double f1[ 3 ]  = { 0.0, 0.0, 0.0 };
+  double f2[ 3 ]  = { 0.0, 0.0, 0.0 };
+  double d1[ 3 ]  = { 0.0, 0.0, 0.0 };
+  double d2[ 3 ]  = { 0.0, 0.0, 0.0 };
+  double old_f1;
+  double old_d1;
+  int    i;
+  int    k;
+
+  tau  = ( 2.0 * t - ta - tb ) / ( tb - ta );
+  tau2 = 2.0 * tau;
+
+  // Same operations order as in APSCheb :: Value
+  for( i = Order; i >= 1; i-- ) {
+    for( k = 0; k < 3; k++ ) {
+      old_f1 = f1[ k ];
+
+      if( pVel ) {
+        old_d1  = d1[ k ];
+        d1[ k ] = tau2 * d1[ k ] - d2[ k ] + 2.0 * f1[ k ];
+        d2[ k ] = old_d1;
+      }
+
+      f1[ k ] = tau2 * f1[ k ] - f2[ k ] + c[ i ][ k ];
+      f2[ k ] = old_f1;
+    }
+  }
+
+  for( k = 0; k < 3; k++ ) {
+    pPos[ k ] = tau * f1[ k ] - f2[ k ] + 0.5 * c[ 0 ][ k ];
+  }
+
+  if( pVel ) {
+    for( k = 0; k < 3; k++ ) {
+      pVel[ k ] = ( tau * d1[ k ] - d2[ k ] + f1[ k ] ) * 2.0 / ( tb - ta );
+    }
+  }
+}
+
+template<int Order>
+int APSChebEval<Order> :: Value( const double t, double * pPos ) const
+{
+  if( RetCode ) {
+    return( RetCode );
+  }
+
+  if( ( t < ta ) || ( t > tb ) ) {
+    return( APS_MODULE_CHEB_TIME );
+  }
+
+  Clenshaw( t, pPos, 0 );
+
+  return( APS_MODULE_CHEB_NO_ERROR );
+}
+
+template<int Order>
+int APSChebEval<Order> :: Value( const double t, double * pPos, double * pVel ) const
+{
+  if( RetCode ) {
+    return( RetCode );
+  }
+
+  if( ( t < ta ) || ( t > tb ) ) {
+    return( APS_MODULE_CHEB_TIME );
+  }
+
+  Clenshaw( t, pPos, pVel );
+
+  return( APS_MODULE_CHEB_NO_ERROR );
+}
+
+template<int Order>
+int APSChebEval<Order> :: Value( const double t, APSVec3d & Val ) const
+{
+  double Pos[ 3 ];
+  int    Result;
+
+  Result = Value( t, Pos );
+
+  if( !Result ) {
+    Val = APSVec3d( Pos[ 0 ], Pos[ 1 ], Pos[ 2 ] );
+  }
+
+  return( Result );
+}
+
+template<int Order>
+int APSChebEval<Order> :: Values( const double * pT, const int Number, double * pPos, double * pVel ) const
+{
+  int i;
+
+  if( RetCode ) {
+    return( RetCode );
+  }
+
+  for( i = 0; i < Number; i++ ) {
+    if( ( pT[ i ] < ta ) || ( pT[ i ] > tb ) ) {
+      return( APS_MODULE_CHEB_TIME );
+    }
+
+    Clenshaw( pT[ i ], pPos + 3 * i, pVel ? pVel + 3 * i : 0 );
+  }
+
+  return( APS_MODULE_CHEB_NO_ERROR );
+}
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 17.05.2004
+//         version 0.2 19.10.2026 APS_MODULE_CHEB_ORDER was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -48,6 +49,8 @@ const std::string APSModuleCheb :: GetMessageText( const int MsgNumber ) const
       return("No error\n");
     case APS_MODULE_CHEB_TIME:
       return("Wrong time interval.\n");
+    case APS_MODULE_CHEB_ORDER:
+      return("Wrong Chebyshev order.\n");
     default:;
   }
 
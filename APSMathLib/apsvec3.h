@@ -0,0 +1,238 @@
+//------------------------------------------------------------------------------
+//
+// File:    apsvec3.h
+//
+// Purpose: Plain 3D vector and matrix for inner loops.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+
+#ifndef APS_VEC3_H
+#define APS_VEC3_H
+
+#include <math.h>
+
+#include "apsvec3d.h"
+#include "apsmat3d.h"
+#include "apsmathconst.h"
+
+namespace aps {
+
+  namespace apsmathlib {
+
+//======================= APSVec3 ==========================
+
+/*
+  Three components and nothing else (24 bytes), trivially copyable and
+  fully inline. Operations are done in the same order as in APSVec3d, so
+  results are the same. Polar coordinates are not cached, they are
+  calculated by Azimuth, Altitude and Norm.
+*/
+
+struct APSVec3
+{
+  double v[ 3 ];
+
+  APSVec3( void ) = default;
+
+  constexpr APSVec3( const double X, const double Y, const double Z ) : v{ X, Y, Z }
+    {}
+
+  explicit APSVec3( const APSVec3d & Vec ) : v{ Vec[ x ], Vec[ y ], Vec[ z ] }
+    {}
+
+  constexpr double operator [] ( const r_index Index ) const
+    { return( v[ Index ] ); }
+
+  double & operator [] ( const r_index Index )
+    { return( v[ Index ] ); }
+
+  // Polar coordinates are not cached, use Azimuth, Altitude and Norm
+  double operator [] ( const pol_index Index ) const = delete;
+
+  APSVec3d GetAPSVec3d( void ) const
+    { return( APSVec3d( v[ 0 ], v[ 1 ], v[ 2 ] ) ); }
+
+  APSVec3 & operator += ( const APSVec3 & Vec )
+    { v[ 0 ] += Vec.v[ 0 ]; v[ 1 ] += Vec.v[ 1 ]; v[ 2 ] += Vec.v[ 2 ]; return( *this ); }
+
+  APSVec3 & operator -= ( const APSVec3 & Vec )
+    { v[ 0 ] -= Vec.v[ 0 ]; v[ 1 ] -= Vec.v[ 1 ]; v[ 2 ] -= Vec.v[ 2 ]; return( *this ); }
+};
+
+inline constexpr double Dot( const APSVec3 & left, const APSVec3 & right )
+{
+  return( left.v[ 0 ] * right.v[ 0 ] + left.v[ 1 ] * right.v[ 1 ] + left.v[ 2 ] * right.v[ 2 ] );
+}
+
+inline double Norm( const APSVec3 & Vec )
+{
+  return( sqrt( Dot( Vec, Vec ) ) );
+}
+
+inline constexpr APSVec3 operator * ( const double fScalar, const APSVec3 & Vec )
+{
+  return( APSVec3( fScalar * Vec.v[ 0 ], fScalar * Vec.v[ 1 ], fScalar * Vec.v[ 2 ] ) );
+}
+
+inline constexpr APSVec3 operator * ( const APSVec3 & Vec, const double fScalar )
+{
+  return( fScalar * Vec );
+}
+
+inline constexpr APSVec3 operator / ( const APSVec3 & Vec, const double fScalar )
+{
+  return( APSVec3( Vec.v[ 0 ] / fScalar, Vec.v[ 1 ] / fScalar, Vec.v[ 2 ] / fScalar ) );
+}
+
+inline constexpr APSVec3 operator - ( const APSVec3 & Vec )
+{
+  return( APSVec3( -Vec.v[ 0 ], -Vec.v[ 1 ], -Vec.v[ 2 ] ) );
+}
+
+inline constexpr APSVec3 operator + ( const APSVec3 & left, const APSVec3 & right )
+{
+  return( APSVec3( left.v[ 0 ] + right.v[ 0 ], left.v[ 1 ] + right.v[ 1 ], left.v[ 2 ] + right.v[ 2 ] ) );
+}
+
+inline constexpr APSVec3 operator - ( const APSVec3 & left, const APSVec3 & right )
+{
+  return( APSVec3( left.v[ 0 ] - right.v[ 0 ], left.v[ 1 ] - right.v[ 1 ], left.v[ 2 ] - right.v[ 2 ] ) );
+}
+
+inline constexpr APSVec3 Cross( const APSVec3 & left, const APSVec3 & right )
+{
+  return( APSVec3( left.v[ 1 ] * right.v[ 2 ] - left.v[ 2 ] * right.v[ 1 ],
+                   left.v[ 2 ] * right.v[ 0 ] - left.v[ 0 ] * right.v[ 2 ],
+                   left.v[ 0 ] * right.v[ 1 ] - left.v[ 1 ] * right.v[ 0 ] ) );
+}
+
+// Same as APSVec3d [ phi ], in [0, 2*pi)
+inline double Azimuth( const APSVec3 & Vec )
+{
+  double Phi;
+
+  if( ( Vec.v[ 0 ] == 0.0 ) && ( Vec.v[ 1 ] == 0.0 ) ) {
+    return( 0.0 );
+  }
+
+  Phi = atan2( Vec.v[ 1 ], Vec.v[ 0 ] );
+
+  if( Phi < 0.0 ) {
+    Phi += 2.0 * pi;
+  }
+
+  return( Phi );
+}
+
+// Same as APSVec3d [ theta ]
+inline double Altitude( const APSVec3 & Vec )
+{
+  const double rho = sqrt( Vec.v[ 0 ] * Vec.v[ 0 ] + Vec.v[ 1 ] * Vec.v[ 1 ] );
+
+  if( ( Vec.v[ 2 ] == 0.0 ) && ( rho == 0.0 ) ) {
+    return( 0.0 );
+  }
+
+  return( atan2( Vec.v[ 2 ], rho ) );
+}
+
+//======================= APSMat3 ==========================
+
+/* Row major 3x3 matrix of nine doubles, see APSVec3 */
+
+struct APSMat3
+{
+  double m[ 3 ][ 3 ];
+
+  APSMat3( void ) = default;
+
+  constexpr APSMat3( const double m00, const double m01, const double m02,
+                     const double m10, const double m11, const double m12,
+                     const double m20, const double m21, const double m22 ) :
+    m{ { m00, m01, m02 }, { m10, m11, m12 }, { m20, m21, m22 } }
+    {}
+
+  explicit APSMat3( const APSMat3d & Mat )
+    {
+      for( int i = 0; i < 3; i++ ) {
+        APSVec3d r_i = Row( Mat, i );
+
+        m[ i ][ 0 ] = r_i[ x ];
+        m[ i ][ 1 ] = r_i[ y ];
+        m[ i ][ 2 ] = r_i[ z ];
+      }
+    }
+
+  APSMat3d GetAPSMat3d( void ) const
+    {
+      return( APSMat3d( APSVec3d( m[ 0 ][ 0 ], m[ 1 ][ 0 ], m[ 2 ][ 0 ] ),
+                        APSVec3d( m[ 0 ][ 1 ], m[ 1 ][ 1 ], m[ 2 ][ 1 ] ),
+                        APSVec3d( m[ 0 ][ 2 ], m[ 1 ][ 2 ], m[ 2 ][ 2 ] ) ) );
+    }
+};
+
+inline constexpr APSVec3 operator * ( const APSMat3 & Mat, const APSVec3 & Vec )
+{
+  return( APSVec3( Mat.m[ 0 ][ 0 ] * Vec.v[ 0 ] + Mat.m[ 0 ][ 1 ] * Vec.v[ 1 ] + Mat.m[ 0 ][ 2 ] * Vec.v[ 2 ],
+                   Mat.m[ 1 ][ 0 ] * Vec.v[ 0 ] + Mat.m[ 1 ][ 1 ] * Vec.v[ 1 ] + Mat.m[ 1 ][ 2 ] * Vec.v[ 2 ],
+                   Mat.m[ 2 ][ 0 ] * Vec.v[ 0 ] + Mat.m[ 2 ][ 1 ] * Vec.v[ 1 ] + Mat.m[ 2 ][ 2 ] * Vec.v[ 2 ] ) );
+}
+
+inline constexpr APSMat3 operator * ( const APSMat3 & left, const APSMat3 & right )
+{
+  return( APSMat3( left.m[ 0 ][ 0 ] * right.m[ 0 ][ 0 ] + left.m[ 0 ][ 1 ] * right.m[ 1 ][ 0 ] + left.m[ 0 ][ 2 ] * right.m[ 2 ][ 0 ],
+                   left.m[ 0 ][ 0 ] * right.m[ 0 ][ 1 ] + left.m[ 0 ][ 1 ] * right.m[ 1 ][ 1 ] + left.m[ 0 ][ 2 ] * right.m[ 2 ][ 1 ],
+                   left.m[ 0 ][ 0 ] * right.m[ 0 ][ 2 ] + left.m[ 0 ][ 1 ] * right.m[ 1 ][ 2 ] + left.m[ 0 ][ 2 ] * right.m[ 2 ][ 2 ],
+                   left.m[ 1 ][ 0 ] * right.m[ 0 ][ 0 ] + left.m[ 1 ][ 1 ] * right.m[ 1 ][ 0 ] + left.m[ 1 ][ 2 ] * right.m[ 2 ][ 0 ],
+                   left.m[ 1 ][ 0 ] * right.m[ 0 ][ 1 ] + left.m[ 1 ][ 1 ] * right.m[ 1 ][ 1 ] + left.m[ 1 ][ 2 ] * right.m[ 2 ][ 1 ],
+                   left.m[ 1 ][ 0 ] * right.m[ 0 ][ 2 ] + left.m[ 1 ][ 1 ] * right.m[ 1 ][ 2 ] + left.m[ 1 ][ 2 ] * right.m[ 2 ][ 2 ],
+                   left.m[ 2 ][ 0 ] * right.m[ 0 ][ 0 ] + left.m[ 2 ][ 1 ] * right.m[ 1 ][ 0 ] + left.m[ 2 ][ 2 ] * right.m[ 2 ][ 0 ],
+                   left.m[ 2 ][ 0 ] * right.m[ 0 ][ 1 ] + left.m[ 2 ][ 1 ] * right.m[ 1 ][ 1 ] + left.m[ 2 ][ 2 ] * right.m[ 2 ][ 1 ],
+                   left.m[ 2 ][ 0 ] * right.m[ 0 ][ 2 ] + left.m[ 2 ][ 1 ] * right.m[ 1 ][ 2 ] + left.m[ 2 ][ 2 ] * right.m[ 2 ][ 2 ] ) );
+}
+
+// Same as R_x, R_z of APSMat3d
+inline APSMat3 Mat3R_x( const double RotAngle )
+{
+  const double S = sin( RotAngle );
+  const double C = cos( RotAngle );
+
+  return( APSMat3( 1.0, 0.0, 0.0,
+                   0.0,  +C,  +S,
+                   0.0,  -S,  +C ) );
+}
+
+inline APSMat3 Mat3R_z( const double RotAngle )
+{
+  const double S = sin( RotAngle );
+  const double C = cos( RotAngle );
+
+  return( APSMat3(  +C,  +S, 0.0,
+                    -S,  +C, 0.0,
+                   0.0, 0.0, 1.0 ) );
+}
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -10,6 +10,8 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <limits>
+#include <pthread.h>
 #include "Common/CommonDefs.h"
 #include "CGLA/ArithVec.h"
 
@@ -24,6 +26,13 @@ class KDTree
  typedef KeyT KeyType;
  typedef std::vector<KeyT> KeyVectorType;
  typedef std::vector<ValT> ValVectorType;
+
+public:
+
+ /// Rank of element, in_box can skip elements of greater rank
+ typedef short RankType;
+
+private:
  
  /// KDNode struct represents node in KD tree
  struct KDNode
@@ -31,11 +40,12 @@ class KDTree
   KeyT key;
   ValT val;
   short dsc;
+  RankType rank; // least rank in the subtree of node
 
-  KDNode(): dsc(0) {}
+  KDNode(): dsc(0), rank(0) {}
 
-  KDNode(const KeyT& _key, const ValT& _val):
-   key(_key), val(_val), dsc(-1) {}
+  KDNode(const KeyT& _key, const ValT& _val, RankType _rank):
+   key(_key), val(_val), dsc(-1), rank(_rank) {}
 
   ScalarType dist(const KeyType& p) const 
   {
@@ -49,6 +59,34 @@ class KDTree
  NodeVecType init_nodes;
  NodeVecType nodes;
 
+ /** KDSplit is inner node of the bucket layout. Leaves (dsc == -1) refer
+   to a contiguous range [begin,end) of bucket_nodes, so the points of a
+   leaf are scanned in one pass through memory. */
+ struct KDSplit
+ {
+  ScalarType value;
+  int dsc;
+  unsigned int begin;
+  unsigned int end;
+  RankType rank;
+
+  KDSplit(): value(0), dsc(-1), begin(0), end(0), rank(0) {}
+ };
+
+ typedef std::vector<KDSplit> SplitVecType;
+ SplitVecType splits;
+ NodeVecType bucket_nodes;
+
+ /// Largest leaf of the bucket layout, 0 for the classic layout
+ unsigned int bucket_size;
+
+ /// Longest path of the tree, bounds traversal stack
+ enum { MAX_STACK = 64 };
+
+ /// Nodes used by queries - either nodes or an attached external array
+ const KDNode* node_data;
+ unsigned int node_count;
+
  /// The greatest depth of KD tree.
  int max_depth;
 
@@ -86,9 +124,51 @@ class KDTree
  /// The dimension -- K
  const int DIM;
 
+ /** BuildTask is a subtree left by the top levels of a parallel build. */
+ struct BuildTask
+ {
+  unsigned int cur;
+  int kvec_beg;
+  int kvec_end;
+  int level;
+  int depth;
+
+  BuildTask(unsigned int _cur, int _beg, int _end, int _level):
+   cur(_cur), kvec_beg(_beg), kvec_end(_end), level(_level), depth(0) {}
+ };
+
+ typedef std::vector<BuildTask> BuildTaskVecType;
+
+ /** Shared state of parallel build workers. */
+ struct BuildPool
+ {
+  KDTree* tree;
+  BuildTaskVecType* tasks;
+  size_t next;
+  pthread_mutex_t mutex;
+ };
+
+ /// Smallest tree built in parallel
+ enum { PARALLEL_MIN_SIZE = 65536 };
+
  /** Passed a vector of keys, this function will construct an optimal tree.
-   It is called recursively - second argument is level in tree. */
- void optimize(unsigned int, int, int, int);
+   It is called recursively - fourth argument is level in tree, the
+   greatest level is kept in depth. If tasks is given, subtrees at
+   task_level are not built but added to tasks. */
+ void optimize(unsigned int, int, int, int, int&, BuildTaskVecType* = 0, int = 0);
+
+ /** Builds top levels, then subtrees by threads workers. Nodes of
+   subtrees do not overlap, so the tree is the same as serial one. */
+ void optimize_parallel(int threads);
+
+ static void* build_worker(void*);
+
+ /** Builds bucket layout of init_nodes[kvec_beg,kvec_end) under split cur. */
+ void optimize_buckets(unsigned int, int, int);
+
+ /** Sets rank of every node to the least rank of its subtree. Children
+   follow their parent in the node array, so one backward pass does it. */
+ void update_ranks();
 
  /** Finde nearest neighbour. */
  int closest_point_priv(int, const KeyType&, ScalarType&) const;
@@ -101,33 +181,103 @@ class KDTree
  
 public:
 
- /** Build tree from vector of keys passed as argument. */
- KDTree():
-  max_depth(0), elements(0), DIM(KeyType::get_dim()) 
+ /** Build tree from vector of keys passed as argument. With non-zero
+   _bucket_size leaves hold up to that many points in a contiguous array
+   (16-64 is a good choice). The bucket layout supports in_box only and
+   can not be stored with get_node_data. */
+ KDTree(unsigned int _bucket_size = 0):
+  bucket_size(_bucket_size), node_data(0), node_count(0), max_depth(0), elements(0), DIM(KeyType::get_dim()) 
+ {
+ }
+
+ /** Elements of greater rank than the limit of in_box are not visited. */
+ void insert(const KeyT& key, const ValT& val, RankType rank = 0)
  {
+  init_nodes.push_back(KDNode(key,val,rank));
  }
 
- void insert(const KeyT& key, const ValT& val)
+ /** Preallocate for n inserted elements. */
+ void reserve(size_t n)
  {
-  init_nodes.push_back(KDNode(key,val));
+  init_nodes.reserve(n);
  }
 
- void build()
+ /** Build tree from inserted elements, classic layout uses up to threads
+   threads. Result does not depend on threads number. */
+ void build(int threads = 1)
  {
+  if(bucket_size > 0)
+   {
+    bucket_nodes.resize(init_nodes.size());
+    splits.resize(2);
+    if(init_nodes.size() > 0)
+     optimize_buckets(1,0,init_nodes.size());
+    update_ranks();
+    NodeVecType v(0);
+    init_nodes.swap(v);
+    node_data  = 0;
+    node_count = splits.size();
+    return;
+   }
   nodes.resize(init_nodes.size()+1);
-  if(init_nodes.size() > 0) 
-   optimize(1,0,init_nodes.size(),0);
+  if(threads > 1 && init_nodes.size() >= PARALLEL_MIN_SIZE)
+   optimize_parallel(threads);
+  else if(init_nodes.size() > 0) 
+   optimize(1,0,init_nodes.size(),0,max_depth);
+  update_ranks();
    NodeVecType v(0);
    init_nodes.swap(v);
+  node_data  = &nodes[0];
+  node_count = nodes.size();
+ }
+
+ /** True if tree has the bucket layout. */
+ bool is_bucketed() const
+ {
+  return bucket_size > 0;
+ }
+
+ /** True if tree was built or attached. */
+ bool is_built() const
+ {
+  return node_count > 0;
+ }
+
+ /** Node array of the built tree, node 0 is unused. Together with
+   get_node_count and get_node_size it can be stored and attached later. */
+ const void* get_node_data() const
+ {
+  return node_data;
+ }
+
+ unsigned int get_node_count() const
+ {
+  return node_count;
+ }
+
+ static size_t get_node_size()
+ {
+  return sizeof(KDNode);
+ }
+
+ /** Use node array stored by a previous build. The array is not copied
+   and must live as long as the tree is queried. */
+ void attach(const void* data, unsigned int count)
+ {
+  NodeVecType v(0);
+  nodes.swap(v);
+  node_data  = static_cast<const KDNode*>(data);
+  node_count = count;
  }
 
   bool closest_point(const KeyT& p, double& dist, KeyT&k, ValT&v) const
  {
+  assert(!is_bucketed());
   double max_sq_dist = CMN::sqr(dist);
   if(int n = closest_point_priv(1, p, max_sq_dist))
    {
-    k = nodes[n].key;
-    v = nodes[n].val;
+    k = node_data[n].key;
+    v = node_data[n].val;
     dist = std::sqrt(max_sq_dist);
     return true;
    }
@@ -145,11 +295,60 @@ public:
         std::vector<KeyT>& keys,
         std::vector<ValT>& vals) const
  {
+  assert(!is_bucketed());
   double max_sq_dist = CMN::sqr(dist);
   in_sphere(1,p,max_sq_dist,keys,vals);
   return keys.size();
  }
-  
+
+ /** Calls f(val) for every element with lo <= key <= hi. Keys are not
+   copied and nothing is allocated. The classic layout gives elements in
+   the same order as in_sphere. f returns false to stop the query.
+   Returns number of elements passed to f. */
+ template<class F>
+ int in_box(const KeyType& lo, const KeyType& hi, F& f) const
+ {
+  return in_box(lo, hi, std::numeric_limits<RankType>::max(), f);
+ }
+
+ /** in_box which skips subtrees with all ranks greater than max_rank.
+   f still gets some elements of greater rank and must check them. */
+ template<class F>
+ int in_box(const KeyType& lo, const KeyType& hi, RankType max_rank, F& f) const;
+
+ /** Output iterator version of in_box. */
+ template<class OutIt>
+ OutIt in_box_copy(const KeyType& lo, const KeyType& hi, OutIt out) const
+ {
+  OutputSink<OutIt> sink(out);
+  in_box(lo, hi, sink);
+  return sink.out;
+ }
+
+private:
+
+ template<class OutIt>
+ struct OutputSink
+ {
+  OutIt out;
+  OutputSink(OutIt _out): out(_out) {}
+  bool operator()(const ValT& v)
+  {
+   *out++ = v;
+   return true;
+  }
+ };
+
+ static bool in_box_key(const KeyType& k, const KeyType& lo, const KeyType& hi)
+ {
+  for(int i=0;i<KeyType::get_dim();i++)
+   if(k[i] < lo[i] || k[i] > hi[i])
+    return false;
+  return true;
+ }
+
+ template<class F>
+ int in_box_buckets(const KeyType& lo, const KeyType& hi, RankType max_rank, F& f) const;
 
 };
 
@@ -175,15 +374,25 @@ template<class KeyT, class ValT>
 void KDTree<KeyT,ValT>::optimize(unsigned int cur,
                  int kvec_beg,  
                  int kvec_end,  
-                 int level)
+                 int level,
+                 int& depth,
+                 BuildTaskVecType* tasks,
+                 int task_level)
 {
  // Assert that we are not inserting beyond capacity.
  assert(cur < nodes.size());
 
+ // Subtree is left for parallel workers.
+ if(tasks && level == task_level)
+  {
+   tasks->push_back(BuildTask(cur, kvec_beg, kvec_end, level));
+   return;
+  }
+
  // If there is just a single element, we simply insert.
  if(kvec_beg+1==kvec_end) 
   {
-   max_depth  = std::max(level,max_depth);
+   depth      = std::max(level,depth);
    nodes[cur] = init_nodes[kvec_beg];
    nodes[cur].dsc = -1;
    return;
@@ -226,10 +435,59 @@ void KDTree<KeyT,ValT>::optimize(unsigned int cur,
 
  // Recursively build left and right tree.
  if(left_size>0) 
-  optimize(2*cur, kvec_beg, median,level+1);
+  optimize(2*cur, kvec_beg, median,level+1,depth,tasks,task_level);
   
  if(right_size>0) 
-  optimize(2*cur+1, median+1, kvec_end,level+1);
+  optimize(2*cur+1, median+1, kvec_end,level+1,depth,tasks,task_level);
+}
+
+template<class KeyT, class ValT>
+void KDTree<KeyT,ValT>::optimize_parallel(int threads)
+{
+ BuildTaskVecType tasks;
+ BuildPool pool;
+
+ // About four subtrees per thread keeps workers busy.
+ int task_level = CMN::two_to_what_power(threads-1) + 3;
+ optimize(1,0,init_nodes.size(),0,max_depth,&tasks,task_level);
+
+ pool.tree  = this;
+ pool.tasks = &tasks;
+ pool.next  = 0;
+ pthread_mutex_init(&pool.mutex, 0);
+
+ std::vector<pthread_t> workers(threads-1);
+ std::vector<bool> started(threads-1, false);
+ for(int i=0;i<threads-1;i++)
+  started[i] = !pthread_create(&workers[i], 0, build_worker, &pool);
+
+ // This thread works too, so the build completes even without workers.
+ build_worker(&pool);
+
+ for(int i=0;i<threads-1;i++)
+  if(started[i])
+   pthread_join(workers[i], 0);
+ pthread_mutex_destroy(&pool.mutex);
+
+ for(size_t i=0;i<tasks.size();i++)
+  max_depth = std::max(max_depth, tasks[i].depth);
+}
+
+template<class KeyT, class ValT>
+void* KDTree<KeyT,ValT>::build_worker(void* arg)
+{
+ BuildPool* pool = static_cast<BuildPool*>(arg);
+ for(;;)
+  {
+   pthread_mutex_lock(&pool->mutex);
+   size_t i = pool->next++;
+   pthread_mutex_unlock(&pool->mutex);
+   if(i >= pool->tasks->size())
+    break;
+   BuildTask& task = (*pool->tasks)[i];
+   pool->tree->optimize(task.cur, task.kvec_beg, task.kvec_end, task.level, task.depth);
+  }
+ return 0;
 }
 
 template<class KeyT, class ValT>
@@ -237,30 +495,30 @@ int KDTree<KeyT,ValT>::closest_point_priv(int n, const KeyType& p,
              ScalarType& dist) const
 {
 	int ret_node = 0;
-	ScalarType this_dist = nodes[n].dist(p);
+	ScalarType this_dist = node_data[n].dist(p);
 
 	if(this_dist<dist)
 		{
 			dist = this_dist;
 			ret_node = n;
 		}
-	if(nodes[n].dsc != -1)
+	if(node_data[n].dsc != -1)
 		{
-			int dsc         = nodes[n].dsc;
-			double dsc_dist  = CMN::sqr(nodes[n].key[dsc]-p[dsc]);
-			bool left_son   = Comp(dsc)(p,nodes[n].key);
+			int dsc         = node_data[n].dsc;
+			double dsc_dist  = CMN::sqr(node_data[n].key[dsc]-p[dsc]);
+			bool left_son   = Comp(dsc)(p,node_data[n].key);
 
 			if(left_son||dsc_dist<dist)
 				{
 					int left_child = 2*n;
-					if(left_child < nodes.size())
+					if(left_child < node_count)
 						if(int nl=closest_point_priv(left_child, p, dist))
 							ret_node = nl;
     }
    if(!left_son||dsc_dist<dist)
     {
      int right_child = 2*n+1;
-     if(right_child < nodes.size())
+     if(right_child < node_count)
       if(int nr=closest_point_priv(right_child, p, dist))
        ret_node = nr;
     }
@@ -275,33 +533,185 @@ void KDTree<KeyT,ValT>::in_sphere(unsigned int n,
                  std::vector<KeyT>& keys,
                  std::vector<ValT>& vals) const
 {
- ScalarType this_dist = nodes[n].dist(p);
- assert(n<nodes.size());
+ ScalarType this_dist = node_data[n].dist(p);
+ assert(n<node_count);
  if(this_dist<dist)
   {
-   keys.push_back(nodes[n].key);
-   vals.push_back(nodes[n].val);
+   keys.push_back(node_data[n].key);
+   vals.push_back(node_data[n].val);
   }
- if(nodes[n].dsc != -1)
+ if(node_data[n].dsc != -1)
   {
-   const int dsc         = nodes[n].dsc;
-   const double dsc_dist  = CMN::sqr(nodes[n].key[dsc]-p[dsc]);
+   const int dsc         = node_data[n].dsc;
+   const double dsc_dist  = CMN::sqr(node_data[n].key[dsc]-p[dsc]);
 
-   bool left_son = Comp(dsc)(p,nodes[n].key);
+   bool left_son = Comp(dsc)(p,node_data[n].key);
 
    if(left_son||dsc_dist<dist)
     {
      unsigned int left_child = 2*n;
-     if(left_child < nodes.size())
+     if(left_child < node_count)
       in_sphere(left_child, p, dist, keys, vals);
     }
    if(!left_son||dsc_dist<dist)
     {
      unsigned int right_child = 2*n+1;
-     if(right_child < nodes.size())
+     if(right_child < node_count)
       in_sphere(right_child, p, dist, keys, vals);
     }
   }
 }
 
+template<class KeyT, class ValT>
+void KDTree<KeyT,ValT>::optimize_buckets(unsigned int cur,
+                 int kvec_beg,  
+                 int kvec_end)
+{
+ if(cur >= splits.size())
+  splits.resize(2*cur);
+
+ KDSplit& split = splits[cur];
+
+ if(kvec_end-kvec_beg <= int(bucket_size))
+  {
+   std::copy(&init_nodes[0]+kvec_beg, &init_nodes[0]+kvec_end, &bucket_nodes[kvec_beg]);
+   split.dsc   = -1;
+   split.begin = kvec_beg;
+   split.end   = kvec_end;
+   return;
+  }
+
+ // Left part gets keys less than or equal the median, right part the
+ // median itself and greater keys
+ int disc   = opt_disc(kvec_beg, kvec_end);
+ int median = kvec_beg + (kvec_end-kvec_beg)/2;
+ const Comp comp(disc);
+ std::nth_element(&init_nodes[0]+kvec_beg, 
+       &init_nodes[0]+median, 
+       &init_nodes[0]+kvec_end, comp);
+
+ split.dsc   = disc;
+ split.value = init_nodes[median].key[disc];
+ split.begin = kvec_beg;
+ split.end   = kvec_end;
+
+ optimize_buckets(2*cur, kvec_beg, median);
+ optimize_buckets(2*cur+1, median, kvec_end);
+}
+
+template<class KeyT, class ValT>
+void KDTree<KeyT,ValT>::update_ranks()
+{
+ if(is_bucketed())
+  {
+   for(unsigned int n=splits.size()-1;n>0;n--)
+    {
+     KDSplit& split = splits[n];
+     if(split.dsc == -1)
+      {
+       if(split.begin == split.end)
+        continue;
+       split.rank = bucket_nodes[split.begin].rank;
+       for(unsigned int i=split.begin+1;i<split.end;i++)
+        split.rank = std::min(split.rank, bucket_nodes[i].rank);
+      }
+     else
+      split.rank = std::min(splits[2*n].rank, splits[2*n+1].rank);
+    }
+   return;
+  }
+ for(unsigned int n=nodes.size()-1;n>1;n--)
+  nodes[n/2].rank = std::min(nodes[n/2].rank, nodes[n].rank);
+}
+
+template<class KeyT, class ValT>
+template<class F>
+int KDTree<KeyT,ValT>::in_box(const KeyType& lo, 
+                 const KeyType& hi, 
+                 RankType max_rank,
+                 F& f) const
+{
+ if(is_bucketed())
+  return in_box_buckets(lo, hi, max_rank, f);
+
+ unsigned int stack[MAX_STACK];
+ int top = 0;
+ int count = 0;
+
+ if(node_count > 1)
+  stack[top++] = 1;
+
+ while(top > 0)
+  {
+   const unsigned int n = stack[--top];
+   const KDNode& node = node_data[n];
+
+   if(node.rank > max_rank)
+    continue;
+
+   if(in_box_key(node.key, lo, hi))
+    {
+     count++;
+     if(!f(node.val))
+      return count;
+    }
+
+   if(node.dsc != -1)
+    {
+     const int dsc = node.dsc;
+     const unsigned int left_child  = 2*n;
+     const unsigned int right_child = 2*n+1;
+
+     // Right child is pushed first so the left one is visited first
+     if(hi[dsc] >= node.key[dsc] && right_child < node_count)
+      stack[top++] = right_child;
+     if(lo[dsc] <= node.key[dsc] && left_child < node_count)
+      stack[top++] = left_child;
+    }
+  }
+ return count;
+}
+
+template<class KeyT, class ValT>
+template<class F>
+int KDTree<KeyT,ValT>::in_box_buckets(const KeyType& lo, 
+                 const KeyType& hi, 
+                 RankType max_rank,
+                 F& f) const
+{
+ unsigned int stack[MAX_STACK];
+ int top = 0;
+ int count = 0;
+
+ if(!bucket_nodes.empty())
+  stack[top++] = 1;
+
+ while(top > 0)
+  {
+   const KDSplit& split = splits[stack[--top]];
+   const unsigned int n = &split - &splits[0];
+
+   if(split.rank > max_rank)
+    continue;
+
+   if(split.dsc == -1)
+    {
+     for(unsigned int i=split.begin;i<split.end;i++)
+      if(bucket_nodes[i].rank <= max_rank && in_box_key(bucket_nodes[i].key, lo, hi))
+       {
+        count++;
+        if(!f(bucket_nodes[i].val))
+         return count;
+       }
+     continue;
+    }
+
+   if(hi[split.dsc] >= split.value)
+    stack[top++] = 2*n+1;
+   if(lo[split.dsc] <= split.value)
+    stack[top++] = 2*n;
+  }
+ return count;
+}
+
 #endif
@@ -22,6 +22,9 @@
 //         version 1.8 21.03.2005 linoccult version 1.0.1 beta
 //         version 1.9 17.04.2005 Updates reading was added. linoccult version 1.1.0 beta
 //         version 1.10 14.10.2005 linoccult version 1.1.0
+//         version 1.11 19.10.2026 Calculate was added, events stream
+//         version 1.12 19.10.2026 Resume from the checkpoint
+//         version 1.13 19.10.2026 Coefficients are not kept if only the events stream needs them
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -41,9 +44,11 @@
 
 #include "loAppl.h"
 #include "loData.h"
+#include "loEventData.h"
 #include "loAstOrbReader.h"
 #include "loGaiaReader.h"
 #include "loWriteEventData.h"
+#include "loStreamEventData.h"
 #include "loWritePositionData.h"
 #include "loReadEventData.h"
 #include "loReadSitesData.h"
@@ -147,6 +152,80 @@ int LinOccultAppl :: WriteEvents( LOData * pLOData ) const
   return( RetCode );
 }
 
+int LinOccultAppl :: Calculate( LOData * pLOData ) const
+{
+  LOStreamEventData * pLOStreamEventData = 0;
+  LOReadEventData   * pLOReadEventData;
+  LOCalc            * pLOCalc;
+  LOCheckpoint        Checkpoint;
+  int                 RetCode = 0;
+
+  if( ( pModule->IfCheckpointFilePath() && !pModule->IfEventsStreamFilePath() ) ||
+      ( pModule->GetResume() && !pModule->IfCheckpointFilePath() ) ) {
+    pModule->ErrorMessage( LO_APPL_CHECKPOINT );
+    return( LO_APPL_CHECKPOINT );
+  }
+
+  if( pModule->IfEventsStreamFilePath() ) {
+    pLOStreamEventData = new LOStreamEventData( pModule->GetEventDataWriterSubModulePtr(), pModule->GetEventsStreamFilePath(),
+                                                pModule->IfCheckpointFilePath() ? pModule->GetCheckpointFilePath() : "" );
+
+    if( pModule->GetResume() ) {
+      if( pLOStreamEventData->Resume( Checkpoint ) ) {
+        delete pLOStreamEventData;
+        return( LO_APPL_WRITE_EVENT_DATA );
+      }
+
+      // Events found before the checkpoint are taken from the stream
+      pLOReadEventData = new LOReadEventData( pModule->GetEventDataReaderSubModulePtr(), pModule->GetEventsStreamFilePath() );
+
+      RetCode = pLOReadEventData->Read( pLOData );
+
+      delete pLOReadEventData;
+
+      if( RetCode ) {
+        delete pLOStreamEventData; // Not closed, the stream may be resumed again
+        return( LO_APPL_READ_EVENT_DATA );
+      }
+    }
+    else if( pLOStreamEventData->Open() ) {
+      delete pLOStreamEventData;
+      return( LO_APPL_WRITE_EVENT_DATA );
+    }
+
+    pLOData->GetEventDataPtr()->SetEventSink( pLOStreamEventData );
+
+    if( !pModule->IfOutputEventsFilePath() ) { // The stream is the only consumer of coefficients
+      pLOData->GetEventDataPtr()->SetKeepCoefs( 0 );
+    }
+  }
+
+  pLOCalc = new LOCalc( pModule->GetCalcSubModulePtr() );
+
+  if( pModule->GetResume() ) {
+    pLOCalc->SetResumeCheckpoint( &Checkpoint );
+  }
+
+  if( pLOCalc->Run( pLOData ) ) {
+    RetCode = LO_APPL_CALC;
+  }
+
+  delete pLOCalc;
+
+  if( pLOStreamEventData ) {
+    pLOData->GetEventDataPtr()->SetEventSink( 0 );
+    pLOData->GetEventDataPtr()->SetKeepCoefs( 1 );
+
+    if( pLOStreamEventData->Close() && !RetCode ) {
+      RetCode = LO_APPL_WRITE_EVENT_DATA;
+    }
+
+    delete pLOStreamEventData;
+  }
+
+  return( RetCode );
+}
+
 int LinOccultAppl :: WritePositions( LOData * pLOData ) const
 {
   LOWritePositionData * pLOWritePositionData;
@@ -196,18 +275,7 @@ int LinOccultAppl :: Run( void )
               RetCode = pLOGaiaReader->Read( pLOData );
 	      
               if( !RetCode ) {
-                pLOCalc = new LOCalc( pModule->GetCalcSubModulePtr() );
-
-                RetCode = pLOCalc->Run( pLOData );
-
-                if( !RetCode ) {
-
-                }
-                else {
-                  RetCode = LO_APPL_CALC;
-                }
-
-                delete pLOCalc;
+                RetCode = Calculate( pLOData );
               }
               else {
                 RetCode = LO_APPL_GAIA_READ;
@@ -12,6 +12,7 @@
 //         version 0.3 27.02.2005 WritePositions was added
 //         version 0.4 15.03.2005 Sites reading was added
 //         version 1.0 17.04.2005 Updates reading was added
+//         version 1.1 19.10.2026 Calculate was added, events stream
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -57,6 +58,9 @@ class LinOccultAppl
 
     int WriteEvents( LOData * pLOData ) const;
 
+    /* Calculation, events are streamed to EventsStreamFilePath while they are found */
+    int Calculate( LOData * pLOData ) const;
+
     int WritePositions( LOData * pLOData ) const;
 
   public:
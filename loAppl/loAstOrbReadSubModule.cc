@@ -10,6 +10,8 @@
 //         version 0.2 26.05.2004 AsteroidNumber parameter
 //         version 0.3 05.03.2005  StartAsteroidNumber, EndAsteroidNumber were added
 //         version 0.4 17.04.2005 UpdatesExpirePeriod was added
+//         version 0.5 19.10.2026 MinA, MaxA, MinDiameter, MaxDiameter, AstOrbThreadsNumber were added
+//         version 0.6 19.10.2026 AstOrbSnapshotFilePath was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -126,6 +128,41 @@ int LOAstOrbReadSubModule :: GetUpdatesExpirePeriod( void ) const
   return( GetLOModuleApplPtr()->GetUpdatesExpirePeriod() );
 }
 
+double LOAstOrbReadSubModule :: GetMinA( void ) const
+{
+  return( GetLOModuleApplPtr()->GetMinA() );
+}
+
+double LOAstOrbReadSubModule :: GetMaxA( void ) const
+{
+  return( GetLOModuleApplPtr()->GetMaxA() );
+}
+
+double LOAstOrbReadSubModule :: GetMinDiameter( void ) const
+{
+  return( GetLOModuleApplPtr()->GetMinDiameter() );
+}
+
+double LOAstOrbReadSubModule :: GetMaxDiameter( void ) const
+{
+  return( GetLOModuleApplPtr()->GetMaxDiameter() );
+}
+
+int LOAstOrbReadSubModule :: GetAstOrbThreadsNumber( void ) const
+{
+  return( GetLOModuleApplPtr()->GetAstOrbThreadsNumber() );
+}
+
+const std::string & LOAstOrbReadSubModule :: GetAstOrbSnapshotFilePath( void ) const
+{
+  return( GetLOModuleApplPtr()->GetAstOrbSnapshotFilePath() );
+}
+
+int LOAstOrbReadSubModule :: IfAstOrbSnapshotFilePath( void ) const
+{
+  return( GetLOModuleApplPtr()->IfAstOrbSnapshotFilePath() );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
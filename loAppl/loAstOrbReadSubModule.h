@@ -10,6 +10,8 @@
 //         version 0.2 26.05.2004 AsteroidNumber parameter
 //         version 0.3 05.03.2005 StartAsteroidNumber, EndAsteroidNumber were added
 //         version 0.4 17.04.2005 UpdatesExpirePeriod was added
+//         version 0.5 19.10.2026 MinA, MaxA, MinDiameter, MaxDiameter, AstOrbThreadsNumber were added
+//         version 0.6 19.10.2026 AstOrbSnapshotFilePath was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -81,6 +83,20 @@ class LOAstOrbReadSubModule : public APSSubModule
     int GetEndAsteroidNumber( void ) const;
 
     int GetUpdatesExpirePeriod( void ) const;
+
+    double GetMinA( void ) const;
+
+    double GetMaxA( void ) const;
+
+    double GetMinDiameter( void ) const;
+
+    double GetMaxDiameter( void ) const;
+
+    int GetAstOrbThreadsNumber( void ) const;
+
+    const std::string & GetAstOrbSnapshotFilePath( void ) const;
+
+    int IfAstOrbSnapshotFilePath( void ) const;
 };
 
 }}
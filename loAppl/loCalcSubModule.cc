@@ -14,6 +14,15 @@
 //                                SunDist was added.
 //         version 0.5 22.02.2005 SunDist -> SunElev
 //         version 0.6 05.03.2005 StartSQLNumber was added.
+//         version 0.7 19.10.2026 KDTreeThreadsNumber was added
+//         version 0.8 19.10.2026 ChebTolerance, ChebMaxSegment were added
+//         version 0.9 19.10.2026 EtUtFilePath was added
+//         version 0.10 19.10.2026 SiteConstraints was added
+//         version 0.11 19.10.2026 Star magnitude limit from minimal drop
+//         version 0.12 19.10.2026 Sun and Moon elongation culling
+//         version 0.13 19.10.2026 CalcThreadsNumber was added
+//         version 0.14 19.10.2026 DayMajorBlock was added
+//         version 0.15 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -186,6 +195,61 @@ int LOCalcSubModule :: GetStartSQLNumber( void ) const
   return( GetLOModuleApplPtr()->GetStartSQLNumber() );
 }
 
+int LOCalcSubModule :: GetKDTreeThreadsNumber( void ) const
+{
+  return( GetLOModuleApplPtr()->GetKDTreeThreadsNumber() );
+}
+
+double LOCalcSubModule :: GetChebTolerance( void ) const
+{
+  return( GetLOModuleApplPtr()->GetChebTolerance() );
+}
+
+double LOCalcSubModule :: GetChebMaxSegment( void ) const
+{
+  return( GetLOModuleApplPtr()->GetChebMaxSegment() );
+}
+
+const std::string & LOCalcSubModule :: GetEtUtFilePath( void ) const
+{
+  return( GetLOModuleApplPtr()->GetEtUtFilePath() );
+}
+
+const std::string & LOCalcSubModule :: GetTaiUtcFilePath( void ) const
+{
+  return( GetLOModuleApplPtr()->GetTaiUtcFilePath() );
+}
+
+int LOCalcSubModule :: GetSiteConstraints( void ) const
+{
+  return( GetLOModuleApplPtr()->GetSiteConstraints() );
+}
+
+double LOCalcSubModule :: GetCalcMinDrop( void ) const
+{
+  return( GetLOModuleApplPtr()->GetCalcMinDrop() );
+}
+
+double LOCalcSubModule :: GetMinSunElongation( void ) const
+{
+  return( GetLOModuleApplPtr()->GetMinSunElongation() );
+}
+
+double LOCalcSubModule :: GetMinMoonElongation( void ) const
+{
+  return( GetLOModuleApplPtr()->GetMinMoonElongation() );
+}
+
+int LOCalcSubModule :: GetCalcThreadsNumber( void ) const
+{
+  return( GetLOModuleApplPtr()->GetCalcThreadsNumber() );
+}
+
+int LOCalcSubModule :: GetDayMajorBlock( void ) const
+{
+  return( GetLOModuleApplPtr()->GetDayMajorBlock() );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
@@ -14,6 +14,15 @@
 //                                SunDist was added.
 //         version 0.5 22.02.2005 SunDist -> SunElev
 //         version 0.6 05.03.2005 StartSQLNumber was added.
+//         version 0.7 19.10.2026 KDTreeThreadsNumber was added
+//         version 0.8 19.10.2026 ChebTolerance, ChebMaxSegment were added
+//         version 0.9 19.10.2026 EtUtFilePath was added
+//         version 0.10 19.10.2026 SiteConstraints was added
+//         version 0.11 19.10.2026 Star magnitude limit from minimal drop
+//         version 0.12 19.10.2026 Sun and Moon elongation culling
+//         version 0.13 19.10.2026 CalcThreadsNumber was added
+//         version 0.14 19.10.2026 DayMajorBlock was added
+//         version 0.15 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -109,6 +118,28 @@ class LOCalcSubModule : public APSSubModule
     double GetSunElev( void ) const;
 
     int GetStartSQLNumber( void ) const;
+
+    int GetKDTreeThreadsNumber( void ) const;
+
+    double GetChebTolerance( void ) const;
+
+    double GetChebMaxSegment( void ) const;
+
+    const std::string & GetEtUtFilePath( void ) const;
+
+    const std::string & GetTaiUtcFilePath( void ) const;
+
+    int GetSiteConstraints( void ) const;
+
+    double GetCalcMinDrop( void ) const;
+
+    double GetMinSunElongation( void ) const;
+
+    double GetMinMoonElongation( void ) const;
+
+    int GetCalcThreadsNumber( void ) const;
+
+    int GetDayMajorBlock( void ) const;
 };
 
 }}
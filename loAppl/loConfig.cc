@@ -19,6 +19,20 @@
 //                                StartSQLNumber were added
 //         version 0.8 31.07.2005 OneStarCatalog, OneStarMv were added
 //         version 0.9 23.08.2005 OneStarParallax was added
+//         version 0.10 19.10.2026 AstOrbThreadsNumber was added
+//         version 0.11 19.10.2026 AstOrbSnapshotFilePath was added
+//         version 0.12 19.10.2026 StarIndexFilePath was added
+//         version 0.13 19.10.2026 KDTreeThreadsNumber was added
+//         version 0.14 19.10.2026 ChebTolerance, ChebMaxSegment were added
+//         version 0.15 19.10.2026 EtUtFilePath was added
+//         version 0.16 19.10.2026 SiteConstraints was added
+//         version 0.17 19.10.2026 Star magnitude limit from minimal drop
+//         version 0.18 19.10.2026 Sun and Moon elongation culling
+//         version 0.19 19.10.2026 CalcThreadsNumber was added
+//         version 0.20 19.10.2026 DayMajorBlock was added
+//         version 0.21 19.10.2026 EventsStreamFilePath was added
+//         version 0.22 19.10.2026 CheckpointFilePath, Resume were added
+//         version 0.23 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -99,6 +113,23 @@ LOConfig :: LOConfig( void ) : APSConfig()
   AddParameter( "StartAsteroidNumber", apslib::PARAM_INTEGER );
   AddParameter( "EndAsteroidNumber", apslib::PARAM_INTEGER );
   AddParameter( "StartSQLNumber", apslib::PARAM_INTEGER );
+  AddParameter( "AstOrbThreadsNumber", apslib::PARAM_INTEGER );
+  AddParameter( "AstOrbSnapshotFilePath", apslib::PARAM_STRING );
+  AddParameter( "StarIndexFilePath", apslib::PARAM_STRING );
+  AddParameter( "KDTreeThreadsNumber", apslib::PARAM_INTEGER );
+  AddParameter( "ChebTolerance", apslib::PARAM_DOUBLE );
+  AddParameter( "ChebMaxSegment", apslib::PARAM_DOUBLE );
+  AddParameter( "EtUtFilePath", apslib::PARAM_STRING );
+  AddParameter( "TaiUtcFilePath", apslib::PARAM_STRING );
+  AddParameter( "SiteConstraints", apslib::PARAM_INTEGER );
+  AddParameter( "CalcMinDrop", apslib::PARAM_DOUBLE );
+  AddParameter( "MinSunElongation", apslib::PARAM_DOUBLE );
+  AddParameter( "MinMoonElongation", apslib::PARAM_DOUBLE );
+  AddParameter( "CalcThreadsNumber", apslib::PARAM_INTEGER );
+  AddParameter( "DayMajorBlock", apslib::PARAM_INTEGER );
+  AddParameter( "EventsStreamFilePath", apslib::PARAM_STRING );
+  AddParameter( "CheckpointFilePath", apslib::PARAM_STRING );
+  AddParameter( "Resume", apslib::PARAM_INTEGER );
 }
 
 LOConfig :: ~LOConfig( void )
@@ -385,6 +416,91 @@ int LOConfig :: GetStartSQLNumber( int & StartSQLNumber ) const
   return( GetIntegerValue( "StartSQLNumber", StartSQLNumber ) );
 }
 
+int LOConfig :: GetAstOrbThreadsNumber( int & AstOrbThreadsNumber ) const
+{
+  return( GetIntegerValue( "AstOrbThreadsNumber", AstOrbThreadsNumber ) );
+}
+
+int LOConfig :: GetAstOrbSnapshotFilePath( std::string & AstOrbSnapshotFilePath ) const
+{
+  return( GetStringValue( "AstOrbSnapshotFilePath", AstOrbSnapshotFilePath ) );
+}
+
+int LOConfig :: GetStarIndexFilePath( std::string & StarIndexFilePath ) const
+{
+  return( GetStringValue( "StarIndexFilePath", StarIndexFilePath ) );
+}
+
+int LOConfig :: GetKDTreeThreadsNumber( int & KDTreeThreadsNumber ) const
+{
+  return( GetIntegerValue( "KDTreeThreadsNumber", KDTreeThreadsNumber ) );
+}
+
+int LOConfig :: GetChebTolerance( double & ChebTolerance ) const
+{
+  return( GetDoubleValue( "ChebTolerance", ChebTolerance ) );
+}
+
+int LOConfig :: GetChebMaxSegment( double & ChebMaxSegment ) const
+{
+  return( GetDoubleValue( "ChebMaxSegment", ChebMaxSegment ) );
+}
+
+int LOConfig :: GetEtUtFilePath( std::string & EtUtFilePath ) const
+{
+  return( GetStringValue( "EtUtFilePath", EtUtFilePath ) );
+}
+
+int LOConfig :: GetTaiUtcFilePath( std::string & TaiUtcFilePath ) const
+{
+  return( GetStringValue( "TaiUtcFilePath", TaiUtcFilePath ) );
+}
+
+int LOConfig :: GetSiteConstraints( int & SiteConstraints ) const
+{
+  return( GetIntegerValue( "SiteConstraints", SiteConstraints ) );
+}
+
+int LOConfig :: GetCalcMinDrop( double & CalcMinDrop ) const
+{
+  return( GetDoubleValue( "CalcMinDrop", CalcMinDrop ) );
+}
+
+int LOConfig :: GetMinSunElongation( double & MinSunElongation ) const
+{
+  return( GetDoubleValue( "MinSunElongation", MinSunElongation ) );
+}
+
+int LOConfig :: GetMinMoonElongation( double & MinMoonElongation ) const
+{
+  return( GetDoubleValue( "MinMoonElongation", MinMoonElongation ) );
+}
+
+int LOConfig :: GetCalcThreadsNumber( int & CalcThreadsNumber ) const
+{
+  return( GetIntegerValue( "CalcThreadsNumber", CalcThreadsNumber ) );
+}
+
+int LOConfig :: GetDayMajorBlock( int & DayMajorBlock ) const
+{
+  return( GetIntegerValue( "DayMajorBlock", DayMajorBlock ) );
+}
+
+int LOConfig :: GetEventsStreamFilePath( std::string & EventsStreamFilePath ) const
+{
+  return( GetStringValue( "EventsStreamFilePath", EventsStreamFilePath ) );
+}
+
+int LOConfig :: GetCheckpointFilePath( std::string & CheckpointFilePath ) const
+{
+  return( GetStringValue( "CheckpointFilePath", CheckpointFilePath ) );
+}
+
+int LOConfig :: GetResume( int & Resume ) const
+{
+  return( GetIntegerValue( "Resume", Resume ) );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
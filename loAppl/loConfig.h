@@ -19,6 +19,20 @@
 //                                StartSQLNumber were added
 //         version 0.8 31.07.2005 OneStarCatalog, OneStarMv were added
 //         version 0.9 23.08.2005 OneStarParallax was added
+//         version 0.10 19.10.2026 AstOrbThreadsNumber was added
+//         version 0.11 19.10.2026 AstOrbSnapshotFilePath was added
+//         version 0.12 19.10.2026 StarIndexFilePath was added
+//         version 0.13 19.10.2026 KDTreeThreadsNumber was added
+//         version 0.14 19.10.2026 ChebTolerance, ChebMaxSegment were added
+//         version 0.15 19.10.2026 EtUtFilePath was added
+//         version 0.16 19.10.2026 SiteConstraints was added
+//         version 0.17 19.10.2026 Star magnitude limit from minimal drop
+//         version 0.18 19.10.2026 Sun and Moon elongation culling
+//         version 0.19 19.10.2026 CalcThreadsNumber was added
+//         version 0.20 19.10.2026 DayMajorBlock was added
+//         version 0.21 19.10.2026 EventsStreamFilePath was added
+//         version 0.22 19.10.2026 CheckpointFilePath, Resume were added
+//         version 0.23 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -170,6 +184,40 @@ class LOConfig : public APSConfig
     int GetEndAsteroidNumber( int & EndAsteroidNumber ) const;
 
     int GetStartSQLNumber( int & StartSQLNumber ) const;
+
+    int GetAstOrbThreadsNumber( int & AstOrbThreadsNumber ) const;
+
+    int GetAstOrbSnapshotFilePath( std::string & AstOrbSnapshotFilePath ) const;
+
+    int GetStarIndexFilePath( std::string & StarIndexFilePath ) const;
+
+    int GetKDTreeThreadsNumber( int & KDTreeThreadsNumber ) const;
+
+    int GetChebTolerance( double & ChebTolerance ) const;
+
+    int GetChebMaxSegment( double & ChebMaxSegment ) const;
+
+    int GetEtUtFilePath( std::string & EtUtFilePath ) const;
+
+    int GetTaiUtcFilePath( std::string & TaiUtcFilePath ) const;
+
+    int GetSiteConstraints( int & SiteConstraints ) const;
+
+    int GetCalcMinDrop( double & CalcMinDrop ) const;
+
+    int GetMinSunElongation( double & MinSunElongation ) const;
+
+    int GetMinMoonElongation( double & MinMoonElongation ) const;
+
+    int GetCalcThreadsNumber( int & CalcThreadsNumber ) const;
+
+    int GetDayMajorBlock( int & DayMajorBlock ) const;
+
+    int GetEventsStreamFilePath( std::string & EventsStreamFilePath ) const;
+
+    int GetCheckpointFilePath( std::string & CheckpointFilePath ) const;
+
+    int GetResume( int & Resume ) const;
 };
 
 }}
@@ -8,6 +8,8 @@
 //
 // Initial version 0.1 15.02.2004
 // Gaia EDR3       0.2 10.01.2021
+//                 0.3 19.10.2026 StarIndexFilePath was added
+//                 0.4 19.10.2026 KDTreeThreadsNumber was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -123,6 +125,21 @@ double LOGaiaReadSubModule :: GetEpoch( void ) const
   return( GetLOModuleApplPtr()->GetEpoch() );
 }
     
+const std::string & LOGaiaReadSubModule :: GetStarIndexFilePath( void ) const
+{
+  return( GetLOModuleApplPtr()->GetStarIndexFilePath() );
+}
+
+int LOGaiaReadSubModule :: IfStarIndexFilePath( void ) const
+{
+  return( GetLOModuleApplPtr()->IfStarIndexFilePath() );
+}
+
+int LOGaiaReadSubModule :: GetKDTreeThreadsNumber( void ) const
+{
+  return( GetLOModuleApplPtr()->GetKDTreeThreadsNumber() );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
@@ -8,6 +8,8 @@
 //
 // Initial version 0.1 15.02.2004
 // Gaia EDR3       0.2 10.01.2021
+//                 0.3 19.10.2026 StarIndexFilePath was added
+//                 0.4 19.10.2026 KDTreeThreadsNumber was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -81,6 +83,12 @@ class LOGaiaReadSubModule : public APSSubModule
     double GetVrad( void ) const;
     
     double GetEpoch( void ) const;
+
+    const std::string & GetStarIndexFilePath( void ) const;
+
+    int IfStarIndexFilePath( void ) const;
+
+    int GetKDTreeThreadsNumber( void ) const;
 };
 
 }}
@@ -27,6 +27,20 @@
 //         version 1.4 23.08.2005 OneStarParallax was added
 //         version 1.5 14.10.2005 UpdatesExpirePeriod = 4 * 365
 //         version 1.6 24.04.2005 Back to UpdatesExpirePeriod = 2 * 365
+//         version 1.7 19.10.2026 AstOrbThreadsNumber was added
+//         version 1.8 19.10.2026 AstOrbSnapshotFilePath was added
+//         version 1.9 19.10.2026 StarIndexFilePath was added
+//         version 1.10 19.10.2026 KDTreeThreadsNumber was added
+//         version 1.11 19.10.2026 ChebTolerance, ChebMaxSegment were added
+//         version 1.12 19.10.2026 EtUtFilePath was added
+//         version 1.13 19.10.2026 SiteConstraints was added
+//         version 1.14 19.10.2026 Star magnitude limit from minimal drop
+//         version 1.15 19.10.2026 Sun and Moon elongation culling
+//         version 1.16 19.10.2026 CalcThreadsNumber was added
+//         version 1.17 19.10.2026 DayMajorBlock was added
+//         version 1.18 19.10.2026 EventsStreamFilePath was added
+//         version 1.19 19.10.2026 CheckpointFilePath, Resume, LO_APPL_CHECKPOINT were added
+//         version 1.20 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -148,6 +162,23 @@ LOModuleAppl :: LOModuleAppl( const std::string & aProjectFilePath,
   StartAsteroidNumber = 1;
   EndAsteroidNumber   = std::numeric_limits<int>::max();
   StartSQLNumber      = 1;
+  AstOrbThreadsNumber = 0;
+  AstOrbSnapshotFilePath = "";
+  StarIndexFilePath   = "";
+  KDTreeThreadsNumber = 0;
+  ChebTolerance       = 0.0;
+  ChebMaxSegment      = 32.0;
+  EtUtFilePath        = "";
+  TaiUtcFilePath      = "";
+  SiteConstraints     = 0;
+  CalcMinDrop         = 0.0;
+  MinSunElongation    = 0.0;
+  MinMoonElongation   = 0.0;
+  CalcThreadsNumber   = 1;
+  DayMajorBlock       = 0;
+  EventsStreamFilePath = "events.stream";
+  CheckpointFilePath  = "checkpoint.bin";
+  Resume              = 0;
 
   OriginAstOrbFilePath       = LO_APPL_PARAM_DEFAULT;
   OriginStarCatalogFilePath  = LO_APPL_PARAM_DEFAULT;
@@ -205,6 +236,23 @@ LOModuleAppl :: LOModuleAppl( const std::string & aProjectFilePath,
   OriginStartAsteroidNumber  = LO_APPL_PARAM_DEFAULT;
   OriginEndAsteroidNumber    = LO_APPL_PARAM_DEFAULT;
   OriginStartSQLNumber       = LO_APPL_PARAM_DEFAULT;
+  OriginAstOrbThreadsNumber  = LO_APPL_PARAM_DEFAULT;
+  OriginAstOrbSnapshotFilePath = LO_APPL_PARAM_DEFAULT;
+  OriginStarIndexFilePath    = LO_APPL_PARAM_DEFAULT;
+  OriginKDTreeThreadsNumber  = LO_APPL_PARAM_DEFAULT;
+  OriginChebTolerance        = LO_APPL_PARAM_DEFAULT;
+  OriginChebMaxSegment       = LO_APPL_PARAM_DEFAULT;
+  OriginEtUtFilePath         = LO_APPL_PARAM_DEFAULT;
+  OriginTaiUtcFilePath       = LO_APPL_PARAM_DEFAULT;
+  OriginSiteConstraints      = LO_APPL_PARAM_DEFAULT;
+  OriginCalcMinDrop          = LO_APPL_PARAM_DEFAULT;
+  OriginMinSunElongation     = LO_APPL_PARAM_DEFAULT;
+  OriginMinMoonElongation    = LO_APPL_PARAM_DEFAULT;
+  OriginCalcThreadsNumber    = LO_APPL_PARAM_DEFAULT;
+  OriginDayMajorBlock        = LO_APPL_PARAM_DEFAULT;
+  OriginEventsStreamFilePath = LO_APPL_PARAM_DEFAULT;
+  OriginCheckpointFilePath   = LO_APPL_PARAM_DEFAULT;
+  OriginResume               = LO_APPL_PARAM_DEFAULT;
 }
 
 LOModuleAppl :: ~LOModuleAppl( void )
@@ -256,6 +304,42 @@ int LOModuleAppl :: IfUpdatesFilePath( void ) const
   return( 1 );
 }
 
+int LOModuleAppl :: IfAstOrbSnapshotFilePath( void ) const
+{
+  if( OriginAstOrbSnapshotFilePath == LO_APPL_PARAM_DEFAULT ) {
+    return( 0 );
+  }
+
+  return( 1 );
+}
+
+int LOModuleAppl :: IfStarIndexFilePath( void ) const
+{
+  if( OriginStarIndexFilePath == LO_APPL_PARAM_DEFAULT ) {
+    return( 0 );
+  }
+
+  return( 1 );
+}
+
+int LOModuleAppl :: IfEventsStreamFilePath( void ) const
+{
+  if( OriginEventsStreamFilePath == LO_APPL_PARAM_DEFAULT ) {
+    return( 0 );
+  }
+
+  return( 1 );
+}
+
+int LOModuleAppl :: IfCheckpointFilePath( void ) const
+{
+  if( OriginCheckpointFilePath == LO_APPL_PARAM_DEFAULT ) {
+    return( 0 );
+  }
+
+  return( 1 );
+}
+
 int LOModuleAppl :: IfEndYear( void ) const
 {
   if( OriginEndYear == LO_APPL_PARAM_DEFAULT ) {
@@ -310,6 +394,8 @@ const std::string LOModuleAppl :: GetMessageText( const int MsgNumber ) const
       return("Init module.\n");
     case LO_APPL_SHOW_PARAM:
       return("");
+    case LO_APPL_CHECKPOINT:
+      return("Checkpoints need EventsStreamFilePath, Resume needs CheckpointFilePath.\n");
     default:;
   }
 
@@ -1078,6 +1164,227 @@ void LOModuleAppl :: PrintParameters( void ) const
       InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
     }
   }
+
+  if( OriginAstOrbThreadsNumber == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter AstOrbThreadsNumber from file " << MAIN_CONFIG_PATH << ": " << std::fixed << AstOrbThreadsNumber << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginAstOrbThreadsNumber == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter AstOrbThreadsNumber from file " << ProjectFilePath << ": " << std::fixed << AstOrbThreadsNumber << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginAstOrbSnapshotFilePath == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter AstOrbSnapshotFilePath from file " << MAIN_CONFIG_PATH << ": " << std::fixed << AstOrbSnapshotFilePath << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginAstOrbSnapshotFilePath == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter AstOrbSnapshotFilePath from file " << ProjectFilePath << ": " << std::fixed << AstOrbSnapshotFilePath << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginStarIndexFilePath == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter StarIndexFilePath from file " << MAIN_CONFIG_PATH << ": " << std::fixed << StarIndexFilePath << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginStarIndexFilePath == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter StarIndexFilePath from file " << ProjectFilePath << ": " << std::fixed << StarIndexFilePath << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginKDTreeThreadsNumber == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter KDTreeThreadsNumber from file " << MAIN_CONFIG_PATH << ": " << std::fixed << KDTreeThreadsNumber << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginKDTreeThreadsNumber == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter KDTreeThreadsNumber from file " << ProjectFilePath << ": " << std::fixed << KDTreeThreadsNumber << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginChebTolerance == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter ChebTolerance from file " << MAIN_CONFIG_PATH << ": " << std::fixed << ChebTolerance << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginChebTolerance == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter ChebTolerance from file " << ProjectFilePath << ": " << std::fixed << ChebTolerance << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginChebMaxSegment == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter ChebMaxSegment from file " << MAIN_CONFIG_PATH << ": " << std::fixed << ChebMaxSegment << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginChebMaxSegment == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter ChebMaxSegment from file " << ProjectFilePath << ": " << std::fixed << ChebMaxSegment << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginEtUtFilePath == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter EtUtFilePath from file " << MAIN_CONFIG_PATH << ": " << std::fixed << EtUtFilePath << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginEtUtFilePath == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter EtUtFilePath from file " << ProjectFilePath << ": " << std::fixed << EtUtFilePath << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginTaiUtcFilePath == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter TaiUtcFilePath from file " << MAIN_CONFIG_PATH << ": " << std::fixed << TaiUtcFilePath << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginTaiUtcFilePath == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter TaiUtcFilePath from file " << ProjectFilePath << ": " << std::fixed << TaiUtcFilePath << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginSiteConstraints == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter SiteConstraints from file " << MAIN_CONFIG_PATH << ": " << std::fixed << SiteConstraints << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginSiteConstraints == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter SiteConstraints from file " << ProjectFilePath << ": " << std::fixed << SiteConstraints << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginCalcMinDrop == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter CalcMinDrop from file " << MAIN_CONFIG_PATH << ": " << std::fixed << CalcMinDrop << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginCalcMinDrop == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter CalcMinDrop from file " << ProjectFilePath << ": " << std::fixed << CalcMinDrop << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginMinSunElongation == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter MinSunElongation from file " << MAIN_CONFIG_PATH << ": " << std::fixed << MinSunElongation << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginMinSunElongation == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter MinSunElongation from file " << ProjectFilePath << ": " << std::fixed << MinSunElongation << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginMinMoonElongation == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter MinMoonElongation from file " << MAIN_CONFIG_PATH << ": " << std::fixed << MinMoonElongation << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginMinMoonElongation == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter MinMoonElongation from file " << ProjectFilePath << ": " << std::fixed << MinMoonElongation << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginCalcThreadsNumber == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter CalcThreadsNumber from file " << MAIN_CONFIG_PATH << ": " << std::fixed << CalcThreadsNumber << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginCalcThreadsNumber == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter CalcThreadsNumber from file " << ProjectFilePath << ": " << std::fixed << CalcThreadsNumber << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginDayMajorBlock == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter DayMajorBlock from file " << MAIN_CONFIG_PATH << ": " << std::fixed << DayMajorBlock << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginDayMajorBlock == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter DayMajorBlock from file " << ProjectFilePath << ": " << std::fixed << DayMajorBlock << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginEventsStreamFilePath == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter EventsStreamFilePath from file " << MAIN_CONFIG_PATH << ": " << std::fixed << EventsStreamFilePath << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginEventsStreamFilePath == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter EventsStreamFilePath from file " << ProjectFilePath << ": " << std::fixed << EventsStreamFilePath << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginCheckpointFilePath == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter CheckpointFilePath from file " << MAIN_CONFIG_PATH << ": " << std::fixed << CheckpointFilePath << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginCheckpointFilePath == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter CheckpointFilePath from file " << ProjectFilePath << ": " << std::fixed << CheckpointFilePath << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
+
+  if( OriginResume == LO_APPL_PARAM_MAIN_CONFIG ) {
+    std::ostringstream Msg;
+    Msg << "Parameter Resume from file " << MAIN_CONFIG_PATH << ": " << std::fixed << Resume << std::endl;
+    InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );    
+  }
+  else {
+    if( OriginResume == LO_APPL_PARAM_EXTRA_CONFIG ) {
+      std::ostringstream Msg;
+      Msg << "Parameter Resume from file " << ProjectFilePath << ": " << std::fixed << Resume << std::endl;
+      InfoMessage( LO_APPL_SHOW_PARAM, Msg.str() );
+    }
+  }
 }
 
 void LOModuleAppl :: UpdateParameters( void )
@@ -1335,6 +1642,74 @@ int LOModuleAppl :: Run( void )
       OriginStartSQLNumber = LO_APPL_PARAM_MAIN_CONFIG;
     }
 
+    if( !pLOConfig->GetAstOrbThreadsNumber( AstOrbThreadsNumber ) ) {
+      OriginAstOrbThreadsNumber = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetAstOrbSnapshotFilePath( AstOrbSnapshotFilePath ) ) {
+      OriginAstOrbSnapshotFilePath = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetStarIndexFilePath( StarIndexFilePath ) ) {
+      OriginStarIndexFilePath = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetKDTreeThreadsNumber( KDTreeThreadsNumber ) ) {
+      OriginKDTreeThreadsNumber = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetChebTolerance( ChebTolerance ) ) {
+      OriginChebTolerance = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetChebMaxSegment( ChebMaxSegment ) ) {
+      OriginChebMaxSegment = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetEtUtFilePath( EtUtFilePath ) ) {
+      OriginEtUtFilePath = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetTaiUtcFilePath( TaiUtcFilePath ) ) {
+      OriginTaiUtcFilePath = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetSiteConstraints( SiteConstraints ) ) {
+      OriginSiteConstraints = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetCalcMinDrop( CalcMinDrop ) ) {
+      OriginCalcMinDrop = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetMinSunElongation( MinSunElongation ) ) {
+      OriginMinSunElongation = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetMinMoonElongation( MinMoonElongation ) ) {
+      OriginMinMoonElongation = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetCalcThreadsNumber( CalcThreadsNumber ) ) {
+      OriginCalcThreadsNumber = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetDayMajorBlock( DayMajorBlock ) ) {
+      OriginDayMajorBlock = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetEventsStreamFilePath( EventsStreamFilePath ) ) {
+      OriginEventsStreamFilePath = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetCheckpointFilePath( CheckpointFilePath ) ) {
+      OriginCheckpointFilePath = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
+    if( !pLOConfig->GetResume( Resume ) ) {
+      OriginResume = LO_APPL_PARAM_MAIN_CONFIG;
+    }
+
     pLOConfig1 = new LOConfig();
 
     pAPSReadConfig1 = new apslib::APSReadConfig( pLOConfigReadSubModule, ProjectFilePath );
@@ -1566,6 +1941,74 @@ int LOModuleAppl :: Run( void )
         OriginStartSQLNumber = LO_APPL_PARAM_EXTRA_CONFIG;
       }
 
+      if( !pLOConfig1->GetAstOrbThreadsNumber( AstOrbThreadsNumber ) ) {
+        OriginAstOrbThreadsNumber = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetAstOrbSnapshotFilePath( AstOrbSnapshotFilePath ) ) {
+        OriginAstOrbSnapshotFilePath = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetStarIndexFilePath( StarIndexFilePath ) ) {
+        OriginStarIndexFilePath = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetKDTreeThreadsNumber( KDTreeThreadsNumber ) ) {
+        OriginKDTreeThreadsNumber = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetChebTolerance( ChebTolerance ) ) {
+        OriginChebTolerance = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetChebMaxSegment( ChebMaxSegment ) ) {
+        OriginChebMaxSegment = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetEtUtFilePath( EtUtFilePath ) ) {
+        OriginEtUtFilePath = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetTaiUtcFilePath( TaiUtcFilePath ) ) {
+        OriginTaiUtcFilePath = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetSiteConstraints( SiteConstraints ) ) {
+        OriginSiteConstraints = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetCalcMinDrop( CalcMinDrop ) ) {
+        OriginCalcMinDrop = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetMinSunElongation( MinSunElongation ) ) {
+        OriginMinSunElongation = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetMinMoonElongation( MinMoonElongation ) ) {
+        OriginMinMoonElongation = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetCalcThreadsNumber( CalcThreadsNumber ) ) {
+        OriginCalcThreadsNumber = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetDayMajorBlock( DayMajorBlock ) ) {
+        OriginDayMajorBlock = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetEventsStreamFilePath( EventsStreamFilePath ) ) {
+        OriginEventsStreamFilePath = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetCheckpointFilePath( CheckpointFilePath ) ) {
+        OriginCheckpointFilePath = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
+      if( !pLOConfig1->GetResume( Resume ) ) {
+        OriginResume = LO_APPL_PARAM_EXTRA_CONFIG;
+      }
+
       UpdateParameters();
 
       PrintParameters();
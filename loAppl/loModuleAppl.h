@@ -23,6 +23,20 @@
 //         version 1.1 17.04.2005 LOUpdatesDataReaderSubModule was added.
 //         version 1.2 31.07.2005 OneStarCatalog, OneStarMv were added
 //         version 1.3 23.08.2005 OneStarParallax was added
+//         version 1.4 19.10.2026 AstOrbThreadsNumber was added
+//         version 1.5 19.10.2026 AstOrbSnapshotFilePath was added
+//         version 1.6 19.10.2026 StarIndexFilePath was added
+//         version 1.7 19.10.2026 KDTreeThreadsNumber was added
+//         version 1.8 19.10.2026 ChebTolerance, ChebMaxSegment were added
+//         version 1.9 19.10.2026 EtUtFilePath was added
+//         version 1.10 19.10.2026 SiteConstraints was added
+//         version 1.11 19.10.2026 Star magnitude limit from minimal drop
+//         version 1.12 19.10.2026 Sun and Moon elongation culling
+//         version 1.13 19.10.2026 CalcThreadsNumber was added
+//         version 1.14 19.10.2026 DayMajorBlock was added
+//         version 1.15 19.10.2026 EventsStreamFilePath was added
+//         version 1.16 19.10.2026 CheckpointFilePath, Resume, LO_APPL_CHECKPOINT were added
+//         version 1.17 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -77,7 +91,8 @@ enum {
   LO_APPL_READ_UPDATES_DATA,
   LO_APPL_START,
   LO_APPL_MODULE,
-  LO_APPL_SHOW_PARAM
+  LO_APPL_SHOW_PARAM,
+  LO_APPL_CHECKPOINT
 };
 
 enum {
@@ -161,6 +176,23 @@ class LOModuleAppl : public APSMainModule
     int         StartAsteroidNumber;
     int         EndAsteroidNumber;
     int         StartSQLNumber;
+    int         AstOrbThreadsNumber;
+    std::string AstOrbSnapshotFilePath;
+    std::string StarIndexFilePath;
+    int         KDTreeThreadsNumber;
+    double      ChebTolerance;
+    double      ChebMaxSegment;
+    std::string EtUtFilePath;
+    std::string TaiUtcFilePath;
+    int         SiteConstraints;
+    double      CalcMinDrop;
+    double      MinSunElongation;
+    double      MinMoonElongation;
+    int         CalcThreadsNumber;
+    int         DayMajorBlock;
+    std::string EventsStreamFilePath;
+    std::string CheckpointFilePath;
+    int         Resume;
 
     int OriginAstOrbFilePath;
     int OriginStarCatalogFilePath;
@@ -218,6 +250,23 @@ class LOModuleAppl : public APSMainModule
     int OriginStartAsteroidNumber;
     int OriginEndAsteroidNumber;
     int OriginStartSQLNumber;
+    int OriginAstOrbThreadsNumber;
+    int OriginAstOrbSnapshotFilePath;
+    int OriginStarIndexFilePath;
+    int OriginKDTreeThreadsNumber;
+    int OriginChebTolerance;
+    int OriginChebMaxSegment;
+    int OriginEtUtFilePath;
+    int OriginTaiUtcFilePath;
+    int OriginSiteConstraints;
+    int OriginCalcMinDrop;
+    int OriginMinSunElongation;
+    int OriginMinMoonElongation;
+    int OriginCalcThreadsNumber;
+    int OriginDayMajorBlock;
+    int OriginEventsStreamFilePath;
+    int OriginCheckpointFilePath;
+    int OriginResume;
 
   public:
 
@@ -440,6 +489,65 @@ class LOModuleAppl : public APSMainModule
     int GetStartSQLNumber( void ) const
       { return( StartSQLNumber ); }
 
+    int GetAstOrbThreadsNumber( void ) const
+      { return( AstOrbThreadsNumber ); }
+
+    const std::string & GetAstOrbSnapshotFilePath( void ) const
+      { return( AstOrbSnapshotFilePath ); }
+
+    int IfAstOrbSnapshotFilePath( void ) const;
+
+    const std::string & GetStarIndexFilePath( void ) const
+      { return( StarIndexFilePath ); }
+
+    int IfStarIndexFilePath( void ) const;
+
+    int GetKDTreeThreadsNumber( void ) const
+      { return( KDTreeThreadsNumber ); }
+
+    double GetChebTolerance( void ) const
+      { return( ChebTolerance ); }
+
+    double GetChebMaxSegment( void ) const
+      { return( ChebMaxSegment ); }
+
+    const std::string & GetEtUtFilePath( void ) const
+      { return( EtUtFilePath ); }
+
+    const std::string & GetTaiUtcFilePath( void ) const
+      { return( TaiUtcFilePath ); }
+
+    int GetSiteConstraints( void ) const
+      { return( SiteConstraints ); }
+
+    double GetCalcMinDrop( void ) const
+      { return( CalcMinDrop ); }
+
+    double GetMinSunElongation( void ) const
+      { return( MinSunElongation ); }
+
+    double GetMinMoonElongation( void ) const
+      { return( MinMoonElongation ); }
+
+    int GetCalcThreadsNumber( void ) const
+      { return( CalcThreadsNumber ); }
+
+    int GetDayMajorBlock( void ) const
+      { return( DayMajorBlock ); }
+
+    const std::string & GetEventsStreamFilePath( void ) const
+      { return( EventsStreamFilePath ); }
+
+    int IfEventsStreamFilePath( void ) const;
+
+    const std::string & GetCheckpointFilePath( void ) const
+      { return( CheckpointFilePath ); }
+
+    int IfCheckpointFilePath( void ) const;
+
+    int GetResume( void ) const
+      { return( Resume ); }
+
     void PrintParameters( void ) const;
 
     void UpdateParameters( void );
@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 22.05.2004
+//         version 0.2 19.10.2026 Table-driven ET-UT was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -34,6 +35,7 @@
 #include "apsspheric.h"
 #include "apsprecnut.h"
 #include "apstime.h"
+#include "apsdeltat.h"
 
 namespace aps {
 
@@ -47,8 +49,9 @@ LOAstOrbCalc :: LOAstOrbCalc( APSSubModule * pAPSSubModule,
                               const double ObservationEpoch,
                               const double M, const double W, const double O,
                               const double I, const double E, const double A,
-                              const double ET_UT, const double T_eqx0, const double aT_eqx ) :
-                              pJPLEph( apJPLEph ), ET_UT_DEF( ET_UT ), T_eqx( aT_eqx )
+                              const double ET_UT, const double T_eqx0, const double aT_eqx,
+                              const APSDeltaT * apDeltaT ) :
+                              pJPLEph( apJPLEph ), pDeltaT( apDeltaT ), ET_UT_DEF( ET_UT ), T_eqx( aT_eqx )
 {
   APSMat3d PQR;
   APSVec3d r;
@@ -105,11 +108,16 @@ int LOAstOrbCalc :: ProcessAsteroid( const double MjdTime, APSVec3d & r_equ ) co
   bool      valid;
   int       RetCode = 0;
 
-  apsastroalg::ETminUT( ( MjdTime - apsastroalg::MJD_J2000 ) / 36525.0, ET_UT, valid );
+  if( pDeltaT ) {
+    ET_UT = pDeltaT->GetETminUT( MjdTime );
+  }
+  else {
+    apsastroalg::ETminUT( ( MjdTime - apsastroalg::MJD_J2000 ) / 36525.0, ET_UT, valid );
 
-  if( !valid ) {
-    pModule->WarningMessage( LO_ASTORBCALC_ET_UT );
-    ET_UT = ET_UT_DEF;
+    if( !valid ) {
+      pModule->WarningMessage( LO_ASTORBCALC_ET_UT );
+      ET_UT = ET_UT_DEF;
+    }
   }
 
   ETMjdTime = MjdTime + ET_UT / 86400.0;
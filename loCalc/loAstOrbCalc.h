@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 22.05.2004
+//         version 0.2 19.10.2026 Table-driven ET-UT was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -44,6 +45,7 @@ namespace aps {
   namespace apsastroalg {
     class APSAstOrbIntegFunction;
     class APSAstOrbCalc;
+    class APSDeltaT;
   }
 
   namespace apslinoccult {
@@ -54,6 +56,7 @@ using apsmathlib::APSMat3d;
 using apsastrodata::APSJPLEph;
 using apsastroalg::APSAstOrbIntegFunction;
 using apsastroalg::APSAstOrbCalc;
+using apsastroalg::APSDeltaT;
 
 class LOModuleAstOrbCalc;
 
@@ -67,6 +70,7 @@ class LOAstOrbCalc
     APSAstOrbCalc          * pAPSAstOrbCalc;
     APSAstOrbIntegFunction * IntegFunction;
     const APSJPLEph        * pJPLEph;
+    const APSDeltaT        * pDeltaT;
     double                   ET_UT_DEF;
     double                   T_eqx;
     APSMat3d                 P;
@@ -82,7 +86,8 @@ class LOAstOrbCalc
                   const double ObservationEpoch,
                   const double M, const double W, const double O,
                   const double I, const double E, const double A,
-                  const double ET_UT, const double T_eqx0, const double aT_eqx );
+                  const double ET_UT, const double T_eqx0, const double aT_eqx,
+                  const APSDeltaT * apDeltaT = 0 );
 
     virtual ~LOAstOrbCalc( void );
 
@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 22.05.2004
+//         version 0.2 19.10.2026 Table-driven ET-UT was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -38,14 +39,15 @@ LOAstOrbChebMaker :: LOAstOrbChebMaker( LOChebMakerSubModule * pLOChebMakerSubMo
                                         const APSJPLEph * apJPLEph, const double ObservationEpoch,
                                         const double M, const double W, const double O,
                                         const double I, const double E, const double A,
-                                        const double ET_UT, const double T_eqx0, const double aT_eqx ) :
+                                        const double ET_UT, const double T_eqx0, const double aT_eqx,
+                                        const APSDeltaT * apDeltaT ) :
                      APSAbsChebMaker()
 {
   pModule = new LOModuleChebAstOrbCalc( pLOChebMakerSubModule );
 
   pLOAstOrbCalc = new LOAstOrbCalc( pModule->GetChebAstOrbSubModulePtr(), apsastroalg::APS_INTEGRATION_DE,
                                     apJPLEph, ObservationEpoch,
-                                    M, W, O, I, E, A, ET_UT, T_eqx0, aT_eqx );
+                                    M, W, O, I, E, A, ET_UT, T_eqx0, aT_eqx, apDeltaT );
 }
 
 LOAstOrbChebMaker :: ~LOAstOrbChebMaker( void )
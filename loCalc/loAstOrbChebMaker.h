@@ -7,6 +7,7 @@
 // (c) 2004 Plekhanov Andrey
 //
 // Initial version 0.1 22.05.2004
+//         version 0.2 19.10.2026 Table-driven ET-UT was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -36,11 +37,16 @@ namespace aps {
     class APSJPLEph;
   }
 
+  namespace apsastroalg {
+    class APSDeltaT;
+  }
+
   namespace apslinoccult {
 
 using apsmathlib::APSAbsChebMaker;
 using apsmathlib::APSVec3d;
 using apsastrodata::APSJPLEph;
+using apsastroalg::APSDeltaT;
 
 class LOChebMakerSubModule;
 class LOModuleChebAstOrbCalc;
@@ -66,7 +72,8 @@ class LOAstOrbChebMaker : public APSAbsChebMaker
                        const APSJPLEph * apJPLEph, const double ObservationEpoch,
                        const double M, const double W, const double O,
                        const double I, const double E, const double A,
-                       const double ET_UT, const double T_eqx0, const double aT_eqx );
+                       const double ET_UT, const double T_eqx0, const double aT_eqx,
+                       const APSDeltaT * apDeltaT = 0 );
 
     virtual ~LOAstOrbChebMaker( void );
 };
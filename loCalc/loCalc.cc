@@ -31,6 +31,24 @@
 // version 2.9 05.03.2005 StartSQLNumber were added.
 // version 2.10 17.08.2005 JPLSunEquPos -> -JPLSunEquPos
 // version 2.11 20.08.2005 Parallax processing 
+// version 2.12 19.10.2026 APSChebEval is used instead of APSCheb
+// version 2.13 19.10.2026 Adaptive Chebyshev segments
+// version 2.14 19.10.2026 Precession-nutation table
+// version 2.15 19.10.2026 Table-driven ET-UT was added
+// version 2.16 19.10.2026 Sun, Moon and Earth positions from APSBodyEph
+// version 2.17 19.10.2026 APSVec3, APSMat3 in inner loops
+// version 2.18 19.10.2026 SiteConstraints was added
+// version 2.19 19.10.2026 Star magnitude limit from minimal drop
+// version 2.20 19.10.2026 Sun and Moon elongation culling
+// version 2.21 19.10.2026 Bisection with asteroid motion bound in ProcessStar1
+// version 2.22 19.10.2026 Closest approaches from Chebyshev series, LOShadowMinima
+// version 2.23 19.10.2026 Time chunks of one asteroid processed by threads
+// version 2.24 19.10.2026 Day-major order, LOAsteroidScan
+// version 2.25 19.10.2026 Checkpoints and resume
+// version 2.26 19.10.2026 Search radius from the MaxDist bound of the window
+// version 2.27 19.10.2026 APSBodyEph fallback uses ephem of the thread
+// version 2.28 19.10.2026 Chunk messages emitted by the calling thread, overlapped chunks
+// version 2.29 19.10.2026 ET-UT at each conversion time, TaiUtc file
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -53,24 +71,38 @@
 #include <sstream>
 #include <iomanip>
 #include <iostream>
+#include <vector>
+
+#include <pthread.h>
+#include <unistd.h>
 
 #include "apsmainmodule.h"
 #include "apsmathconst.h"
 #include "apsastroconst.h"
 #include "apsvec3d.h"
 #include "apsmat3d.h"
+#include "apsvec3.h"
 #include "apsangle.h"
 #include "apsjpleph.h"
+#include "apsbodyeph.h"
 #include "apsspheric.h"
 #include "apsprecnut.h"
+#include "apsprecnuttable.h"
+#include "apsdeltat.h"
+#include "apsetutdata.h"
+#include "EtUtReader.h"
+#include "apstaiutcdata.h"
+#include "TaiUtcReader.h"
 #include "apskepler.h"
 #include "apstime.h"
-#include "apscheb.h"
+#include "apschebeval.h"
 #include "loCalc.h"
+#include "loShadowMinima.h"
 #include "loData.h"
 #include "loAstOrbData.h"
 #include "loStarData.h"
 #include "loEventData.h"
+#include "loEventSink.h"
 #include "loPointEventData.h"
 #include "loPosData.h"
 #include "loAsteroid.h"
@@ -85,6 +117,7 @@
 #include "loChebMakerSubModule.h"
 #include "loChebSubModule.h"
 #include "loAstOrbSubModule.h"
+#include "loEtUtSubModule.h"
 
 //#define WITH_MYSQL 1
 
@@ -103,9 +136,102 @@ const double fac                 = 0.996647;     // Ratio polar/equat. Earth rad
 const int    CHEB_ORDER          = 11;
 const int    SAVE_CHEB_ORDER     = 11;
 const double CHEB_STEP           = 1.0;          // One day
+const int    MAX_CHEB_ORDER      = 15;
+const double MIN_CHEB_SEGMENT    = CHEB_STEP / 16.0;
+const double WINDOW_EPS          = 1.0e-9;       // Days
 const int    OZI                 = 0;
 const int    SMALL_STEP          = 60;      // 1 sec
 const int    PROGRESS_POS_STEP   = 1000;
+const double SITE_DROP_MARGIN    = 0.01;    // Mag
+const double SITE_SUN_MARGIN     = 1.0;     // Degrees
+const double DROP_MV_MARGIN      = 0.05;    // Mag
+const double SUN_ELONG_MARGIN    = 1.0;     // Degrees, Sun motion in half a day and asteroid parallax
+const double MOON_ELONG_MARGIN   = 1.5;     // Degrees, Moon and asteroid parallax
+const int    MAX_SHADOW_MINIMA   = 16;      // Closest approaches of one star per window
+const int    MAX_SHADOW_RUNS     = 16;      // Parts of a window searched for approaches of one star
+const int    MIN_CHUNK_WINDOWS   = 8;       // Scan windows of one time chunk at least
+const double CHUNK_OVERLAP       = 1.0;     // Days scanned before a time chunk, longer than any event
+const int    CHECKPOINT_PERIOD   = 60;      // Seconds between checkpoints
+
+//======================= LOChebSegment ==========================
+
+/* Asteroid position over [Begin, End], AU */
+struct LOChebSegment
+{
+  unsigned int Order;
+  double       Begin;
+  double       End;
+  double       cX[ MAX_CHEB_ORDER + 1 ];
+  double       cY[ MAX_CHEB_ORDER + 1 ];
+  double       cZ[ MAX_CHEB_ORDER + 1 ];
+};
+
+//======================= LOScanWindow ==========================
+
+/* Stars are scanned in windows of one day at most, each with ScanStep points */
+struct LOScanWindow
+{
+  unsigned int Segment;
+  double       Begin;
+  double       Length;
+};
+
+//======================= LOChunkEvent ==========================
+
+/* Event found in a time chunk, it is saved after all chunks are processed */
+struct LOChunkEvent
+{
+  const LOStar * pLOStar;
+  double         ApproachMjdate;  // Closest approach the event was created for
+  double         BeginOccTime;
+  double         EndOccTime;
+  int            EarthFlag;
+  double         MaxDuration;
+};
+
+//======================= LOChunkMessage ==========================
+
+/* Message of a time chunk, it is emitted by the calling thread when the chunk events are saved */
+struct LOChunkMessage
+{
+  int            Code;            // InfoMessage code, 0 for text of std::cout
+  std::string    Text;
+};
+
+//======================= LOTimeChunk ==========================
+
+/* Scan windows [FirstWindow, LastWindow) of one asteroid processed by pLOCalc. Windows
+   from ScanWindow are scanned too, events of the chunk have approaches in [BeginMjdate, EndMjdate) */
+struct LOTimeChunk
+{
+  LOCalc                           * pLOCalc;
+  const LOAsteroid                 * pLOAsteroid;
+  const LOStarData                 * pLOStarData;
+  const std::vector<LOChebSegment> * pSegments;
+  const std::vector<LOScanWindow>  * pWindows;
+  unsigned int                       ScanWindow;
+  unsigned int                       FirstWindow;
+  unsigned int                       LastWindow;
+  double                             BeginMjdate;
+  double                             EndMjdate;
+  int                                RetCode;
+  std::vector<LOChunkEvent>          Events;
+  std::vector<LOChunkMessage>        Messages;
+};
+
+//======================= LOAsteroidScan ==========================
+
+/* Segments and windows of one asteroid created one after another, the integrator keeps its state between them */
+struct LOAsteroidScan
+{
+  const LOAsteroid  * pLOAsteroid;
+  LOAstOrbChebMaker * pLOAstOrbChebMaker;
+  double              NextSegmentLength;
+  unsigned int        SegmentsNumber;
+  LOChebSegment       Segment;      // Current segment
+  LOScanWindow        Window;       // Current window, valid if IfWindow
+  int                 IfWindow;
+};
 
 int    ShowNumber = 1;
 
@@ -132,28 +258,377 @@ double UTCmin = 0.0;
 LOCalc :: LOCalc( LOCalcSubModule * pLOCalcSubModule )
 {
   pModule    = new LOModuleCalc( pLOCalcSubModule );
+  pParent    = 0;
   ephem      = 0;
   StarsCount = 0;
   EventStar  = -1;
   ChebArray  = new APSVec3d * [ pModule->GetScanStep() ];
+  ChebTimes  = new double [ pModule->GetScanStep() ];
+  ChebValues = new double [ 3 * pModule->GetScanStep() ];
+  ChebStepBound = 0.0;
+  ChebMaxDistance = 0.0;
+  pShadowMinima = new LOShadowMinima();
+  pPrecNutTable = 0;
+  pDeltaT       = 0;
+  pBodyEph      = 0;
+
+  IfSiteLimits       = 0;
+  SiteMaxMv          = LOStarData :: NO_MV_LIMIT;
+  SiteMinDuration    = 0.0;
+  SiteMinDrop        = 0.0;
+  SiteMaxSunElev     = 90.0;
+  SiteMaxDistance    = 0.0;
+  SiteRejectedEvents = 0;
+
+  ElongationCulledDays = 0.0;
 
   for( int i = 0; i < pModule->GetScanStep(); i++ ) {
     ChebArray[ i ] = new APSVec3d();
   }
 
   AU = 0.0;
+
+  pWorkers      = 0;
+  WorkersNumber = 0;
+  pChunkEvents  = 0;
+  pChunkMessages = 0;
+
+  pResumeCheckpoint = 0;
+  CheckpointTime    = 0;
+}
+
+LOCalc :: LOCalc( const LOCalc * apParent )
+{
+  pModule    = apParent->pModule;
+  pParent    = apParent;
+  ephem      = 0;
+  MjdStart   = apParent->MjdStart;
+  MjdEnd     = apParent->MjdEnd;
+  StarsCount = 0;
+  EventStar  = -1;
+  ChebArray  = new APSVec3d * [ pModule->GetScanStep() ];
+  ChebTimes  = new double [ pModule->GetScanStep() ];
+  ChebValues = new double [ 3 * pModule->GetScanStep() ];
+  ChebStepBound = 0.0;
+  ChebMaxDistance = 0.0;
+  pShadowMinima = new LOShadowMinima();
+  pPrecNutTable = apParent->pPrecNutTable;
+  pDeltaT       = apParent->pDeltaT;
+  pBodyEph      = apParent->pBodyEph;
+
+  IfSiteLimits       = apParent->IfSiteLimits;
+  SiteMaxMv          = apParent->SiteMaxMv;
+  SiteMinDuration    = apParent->SiteMinDuration;
+  SiteMinDrop        = apParent->SiteMinDrop;
+  SiteMaxSunElev     = apParent->SiteMaxSunElev;
+  SiteMaxDistance    = apParent->SiteMaxDistance;
+  SiteRejectedEvents = 0;
+
+  ElongationCulledDays = 0.0;
+
+  for( int i = 0; i < pModule->GetScanStep(); i++ ) {
+    ChebArray[ i ] = new APSVec3d();
+  }
+
+  AU = apParent->AU;
+
+  pWorkers      = 0;
+  WorkersNumber = 0;
+  pChunkEvents  = 0;
+  pChunkMessages = 0;
+
+  pResumeCheckpoint = 0;
+  CheckpointTime    = 0;
 }
 
 LOCalc :: ~LOCalc( void )
 {
   int i;
 
+  DeleteWorkers();
+
   for( i = 0; i < pModule->GetScanStep(); i++ ) {
     delete ChebArray[ i ];
   }
 
   delete ChebArray;
-  delete pModule;
+  delete [] ChebTimes;
+  delete [] ChebValues;
+  delete pShadowMinima;
+
+  if( pParent ) { // Tables and module of the main calculation
+    delete ephem;
+  }
+  else {
+    delete pPrecNutTable;
+    delete pDeltaT;
+    delete pBodyEph;
+    delete pModule;
+  }
+}
+
+int LOCalc :: CreateWorkers( void )
+{
+  LOCalc * pWorker;
+  int      ThreadsNumber;
+  int      RetCode = 0;
+
+  ThreadsNumber = pModule->GetCalcThreadsNumber();
+
+  if( ThreadsNumber <= 0 ) {
+    ThreadsNumber = static_cast<int>( sysconf( _SC_NPROCESSORS_ONLN ) );
+  }
+
+  if( ThreadsNumber > 1 ) {
+    pWorkers = new LOCalc * [ ThreadsNumber - 1 ];
+
+    while( WorkersNumber < ThreadsNumber - 1 ) {
+      pWorker = new LOCalc( this );
+
+      pWorker->ephem = new APSJPLEph();
+
+      if( pWorker->ephem->Init( pModule->GetJPLEphemFilePath() ) != apsastrodata::APS_JPL_NO_ERROR ) {
+        delete pWorker;
+        pModule->ErrorMessage( LO_CALC_JPL_INIT );
+        RetCode = LO_CALC_JPL_INIT;
+        break;
+      }
+
+      pWorkers[ WorkersNumber++ ] = pWorker;
+    }
+  }
+
+  return( RetCode );
+}
+
+void LOCalc :: DeleteWorkers( void )
+{
+  while( WorkersNumber > 0 ) {
+    delete pWorkers[ --WorkersNumber ];
+  }
+
+  delete [] pWorkers;
+
+  pWorkers = 0;
+}
+
+APSMat3d LOCalc :: GetEquToTrueMatrix( const double Mjd ) const
+{
+  if( pPrecNutTable ) {
+    return( pPrecNutTable->GetEquToTrueMatrix( Mjd ) );
+  }
+
+  return( APSPrecNutTable :: CalcEquToTrueMatrix( Mjd ) );
+}
+
+double LOCalc :: GetEquEqu( const double Mjd ) const
+{
+  if( pPrecNutTable ) {
+    return( pPrecNutTable->GetEquEqu( Mjd ) );
+  }
+
+  return( APSPrecNutTable :: CalcEquEqu( Mjd ) );
+}
+
+void LOCalc :: CreatePrecNutTable( const double BeginMjd, const double EndMjd )
+{
+  delete pPrecNutTable;
+
+  // One day margin for ET - UT and occultations at the interval ends
+  pPrecNutTable = new APSPrecNutTable( BeginMjd - 1.0, EndMjd + 1.0 );
+}
+
+APSVec3d LOCalc :: SunEquPos( const double Mjd ) const
+{
+  if( pBodyEph ) {
+    return( pBodyEph->SunEquPos( ephem, Mjd ) );
+  }
+
+  return( ephem->SunEquPos( Mjd ) );
+}
+
+APSVec3d LOCalc :: MoonEquPos( const double Mjd ) const
+{
+  if( pBodyEph ) {
+    return( pBodyEph->MoonEquPos( ephem, Mjd ) );
+  }
+
+  return( ephem->MoonEquPos( Mjd ) );
+}
+
+APSVec3d LOCalc :: EarthBaryEquPos( const double Mjd ) const
+{
+  if( pBodyEph ) {
+    return( pBodyEph->EarthBaryEquPos( ephem, Mjd ) );
+  }
+
+  return( ephem->EarthBaryEquPos( Mjd ) );
+}
+
+void LOCalc :: CreateBodyEph( const double BeginMjd, const double EndMjd )
+{
+  delete pBodyEph;
+
+  // One day margin for ET - UT and occultations at the interval ends
+  pBodyEph = new APSBodyEph( ephem, BeginMjd - 1.0, EndMjd + 1.0 );
+}
+
+void LOCalc :: DeleteBodyEph( void )
+{
+  delete pBodyEph;
+
+  pBodyEph = 0;
+}
+
+void LOCalc :: CreateSiteLimits( LOPosData * pLOPosData )
+{
+  const LOPos  * pLOPos;
+  unsigned int   i;
+  double         MaxMv;
+
+  IfSiteLimits = 0;
+
+  if( !pModule->GetSiteConstraints() ) {
+    return;
+  }
+
+  pLOPosData->Rebuild();
+
+  if( !pLOPosData->GetPositionsNumber() ) {
+    return;
+  }
+
+  pLOPos = pLOPosData->GetPositionPtr( 0 );
+
+  MaxMv           = pLOPos->GetMaxMv();
+  SiteMinDuration = pLOPos->GetMinDuration();
+  SiteMinDrop     = pLOPos->GetMinDrop();
+  SiteMaxSunElev  = pLOPos->GetSunElev();
+  SiteMaxDistance = pLOPos->GetMaxDistance();
+
+  for( i = 1; i < pLOPosData->GetPositionsNumber(); i++ ) {
+    pLOPos = pLOPosData->GetPositionPtr( i );
+
+    MaxMv           = std::max( MaxMv, static_cast<double>( pLOPos->GetMaxMv() ) );
+    SiteMinDuration = std::min( SiteMinDuration, pLOPos->GetMinDuration() );
+    SiteMinDrop     = std::min( SiteMinDrop, pLOPos->GetMinDrop() );
+    SiteMaxSunElev  = std::max( SiteMaxSunElev, pLOPos->GetSunElev() );
+    SiteMaxDistance = std::max( SiteMaxDistance, pLOPos->GetMaxDistance() );
+  }
+
+  // Rounded up, stars are checked as Mv / 100.0 <= MaxMv in ProcessOnePosition
+  if( MaxMv * 100.0 < LOStarData :: NO_MV_LIMIT ) {
+    SiteMaxMv = static_cast<short>( ceil( MaxMv * 100.0 ) );
+  }
+
+  IfSiteLimits = 1;
+
+  std::ostringstream Msg;
+  Msg << "MaxMv = " << std::fixed << std::setprecision(2) << MaxMv <<
+         " MinDuration = " << SiteMinDuration << " MinDrop = " << SiteMinDrop <<
+         " SunElev = " << SiteMaxSunElev << " MaxDistance = " << SiteMaxDistance << std::endl;
+  pModule->InfoMessage( LO_CALC_SITE_CONSTRAINTS, Msg.str() );
+}
+
+int LOCalc :: IfSiteAccepted( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar,
+                              const APSVec3d & rAstAU, const double ETMjdate,
+                              const int EarthFlag, const double MaxDuration, const double MinTrackSunElev ) const
+{
+  double Brightness;
+  double SunElevMargin;
+
+  // IfDistanceCheb finds no points without crossing of the Earth
+  if( !EarthFlag ) {
+    return( 0 );
+  }
+
+  if( MaxDuration < SiteMinDuration ) {
+    return( 0 );
+  }
+
+  Brightness = CalculateBrightness( pLOAsteroid, SunEquPos( ETMjdate ), rAstAU );
+
+  if( std::fabs( CalculateBrightDelta( pLOStar->GetMv(), Brightness ) ) < SiteMinDrop - SITE_DROP_MARGIN ) {
+    return( 0 );
+  }
+
+  // Sites up to MaxDistance from the path see the Sun up to this angle higher or lower
+  SunElevMargin = apsmathlib::Deg * ( SiteMaxDistance + pLOAsteroid->GetDiameter() / 2.0 ) / apsastroalg::R_Earth +
+                  SITE_SUN_MARGIN;
+
+  if( apsmathlib::Deg * MinTrackSunElev > SiteMaxSunElev + SunElevMargin ) {
+    return( 0 );
+  }
+
+  return( 1 );
+}
+
+double LOCalc :: GetETminUT( const double Mjd ) const
+{
+  double ET_UT;
+  bool   valid;
+
+  if( pDeltaT ) {
+    return( pDeltaT->GetETminUT( Mjd ) );
+  }
+
+  apsastroalg::ETminUT( ( Mjd - apsastroalg::MJD_J2000 ) / 36525.0, ET_UT, valid );
+
+  if( !valid ) {
+    ET_UT = pModule->GetET_UT();
+  }
+
+  return( ET_UT );
+}
+
+int LOCalc :: CreateDeltaT( void )
+{
+  apsastrodata::APSEtUtData * pAPSEtUtData;
+  apsastroio::EtUtReader    * pEtUtReader;
+  int                         RetCode = 0;
+
+  delete pDeltaT;
+
+  pDeltaT = 0;
+
+  if( pModule->GetEtUtFilePath().empty() ) {
+    if( pModule->GetTaiUtcFilePath().empty() ) {
+      pDeltaT = new APSDeltaT( pModule->GetET_UT() );
+      return( RetCode );
+    }
+
+    apsastrodata::APSTaiUtcData * pAPSTaiUtcData = new apsastrodata::APSTaiUtcData( pModule->GetEtUtSubModulePtr() );
+    apsastroio::TaiUtcReader    * pTaiUtcReader  = new apsastroio::TaiUtcReader( pModule->GetEtUtSubModulePtr(), pModule->GetTaiUtcFilePath() );
+
+    if( !pTaiUtcReader->Read( pAPSTaiUtcData ) ) {
+      pDeltaT = new APSDeltaT( pAPSTaiUtcData );
+    }
+    else {
+      pModule->ErrorMessage( LO_CALC_ET_UT );
+      RetCode = LO_CALC_ET_UT;
+    }
+
+    delete pTaiUtcReader;
+    delete pAPSTaiUtcData;
+
+    return( RetCode );
+  }
+
+  pAPSEtUtData = new apsastrodata::APSEtUtData( pModule->GetEtUtSubModulePtr() );
+  pEtUtReader  = new apsastroio::EtUtReader( pModule->GetEtUtSubModulePtr(), pModule->GetEtUtFilePath() );
+
+  if( !pEtUtReader->Read( pAPSEtUtData ) ) {
+    pDeltaT = new APSDeltaT( pAPSEtUtData );
+  }
+  else {
+    pModule->ErrorMessage( LO_CALC_ET_UT );
+    RetCode = LO_CALC_ET_UT;
+  }
+
+  delete pEtUtReader;
+  delete pAPSEtUtData;
+
+  return( RetCode );
 }
 
 int LOCalc :: AddStar( const LOStar * pStar )
@@ -257,7 +732,7 @@ void LOCalc :: ScanStars1( const LOStarData * pLOStarData, APSVec3d * r_Asteroid
   }
 }
 
-int LOCalc :: ScanStars2( const LOStarData * pLOStarData, const int ScanStep )
+int LOCalc :: ScanStars2( const LOStarData * pLOStarData, const int ScanStep, const short MaxMv )
 {
   int            i;
   double         RA_MIN;
@@ -266,7 +741,6 @@ int LOCalc :: ScanStars2( const LOStarData * pLOStarData, const int ScanStep )
   double         Dec_MAX;
   double         Tmp_RA;
   double         Tmp_Dec;
-  const LOStar * pLOStar;
   int            RetCode;
 
   RetCode = 0;
@@ -318,29 +792,15 @@ int LOCalc :: ScanStars2( const LOStarData * pLOStarData, const int ScanStep )
     }
   }*/
 
-const LOStar * pNewLOStarsArray[ MAX_STAR_NUMBER ];
-unsigned int NewStarNumber;
+// Stars are found straight into pLOStarsArray, a local array of MAX_STAR_NUMBER does not fit thread stack
+StarsCount = MAX_STAR_NUMBER;
 
-NewStarNumber = MAX_STAR_NUMBER;
-
-if( pLOStarData->FastFindStars( pNewLOStarsArray, NewStarNumber, RA_MIN - ANGLE_DELTA1, Dec_MIN - ANGLE_DELTA1,
-                               RA_MAX + ANGLE_DELTA1, Dec_MAX + ANGLE_DELTA1 ) ) {
-  std::cout << "WARNING: too many stars 4" << std::endl;
+if( pLOStarData->FastFindStars( pLOStarsArray, StarsCount, RA_MIN - ANGLE_DELTA1, Dec_MIN - ANGLE_DELTA1,
+                               RA_MAX + ANGLE_DELTA1, Dec_MAX + ANGLE_DELTA1, MaxMv ) ) {
+  PrintMessage( "WARNING: too many stars 4\n" );
   //RetCode = 1;
 }
 
-ClearStarsArray();
-
-for( unsigned int j = 0; j < NewStarNumber; j++ ) {
-  pLOStar = pNewLOStarsArray[ j ];
-
-  if( AddStar( pLOStar ) ) {
-    std::cout << "WARNING: too many stars 5" << std::endl;
-    //RetCode = 1;
-    break;
-  }
-}
-
 //printf("StarNumber = %d NewStarNumber = %d\n", StarsCount, NewStarNumber );
 
   return( RetCode );
@@ -354,9 +814,8 @@ void LOCalc :: CalcStrip( const double t_prev, const APSVec3d & r_prev, const AP
   APSVec3d r_G;
   double   VecLength;
   APSVec3d Vec1 = Cross( r_now - r_prev, eStar );
-  double   T = ( t_prev - apsastroalg::MJD_J2000 ) / 36525.0;
-  APSMat3d PrecMat = apsastroalg::NutMatrix( T ) * apsastroalg::PrecMatrix_Equ( apsastroalg::T_J2000, T );
-  double   UT_UTC  = pModule->GetUT_UTC() + apsastroalg::equequ( T );
+  APSMat3d PrecMat = GetEquToTrueMatrix( t_prev );
+  double   UT_UTC  = pModule->GetUT_UTC() + GetEquEqu( t_prev );
 
   Vec1 = Vec1 / Norm( Vec1 );
 
@@ -457,6 +916,111 @@ double LOCalc :: CalculateBrightness( const LOAsteroid * pLOAsteroid, const APSV
   return( Brightness );
 }
 
+double LOCalc :: CalculateBrightDelta( const short Mv, const double Brightness )
+{
+  return( log10( pow( 2.512, Mv / 100.0 ) + pow( 2.512, Brightness ) ) / log10( 2.512 ) - Mv / 100.0 );
+}
+
+bool LOCalc :: IfElongationCulled( const double BeginMjdate, const double Step, const int ScanStep ) const
+{
+  APSVec3 eAst;
+  APSVec3 ePrevAst;
+  APSVec3 eSun;
+  APSVec3 eMoon;
+  APSVec3 ePrevMoon;
+  double  MinSunElong;
+  double  MinMoonElong;
+  double  SunElong   = 0.0;
+  double  MoonElong  = 0.0;
+  double  AstMotion  = 0.0;
+  double  MoonMotion = 0.0;
+  int     i;
+
+  MinSunElong  = pModule->GetMinSunElongation();
+  MinMoonElong = pModule->GetMinMoonElongation();
+
+  if( ( MinSunElong <= 0.0 ) && ( MinMoonElong <= 0.0 ) ) {
+    return( false );
+  }
+
+  // Sun moves less than a degree per day, one position serves the whole window
+  eSun = APSVec3( SunEquPos( GetETMjdate( BeginMjdate + Step * ScanStep / 2.0 ) ) );
+
+  for( i = 0; i < ScanStep; i++ ) {
+    eAst = APSVec3( ChebValues[ 3 * i ], ChebValues[ 3 * i + 1 ], ChebValues[ 3 * i + 2 ] / fac );
+
+    SunElong = std::max( SunElong, atan2( Norm( Cross( eAst, eSun ) ), Dot( eAst, eSun ) ) );
+
+    if( MinMoonElong > 0.0 ) {
+      eMoon = APSVec3( MoonEquPos( GetETMjdate( BeginMjdate + i * Step ) ) );
+
+      MoonElong = std::max( MoonElong, atan2( Norm( Cross( eAst, eMoon ) ), Dot( eAst, eMoon ) ) );
+
+      if( i ) {
+        MoonMotion = std::max( MoonMotion, atan2( Norm( Cross( eMoon, ePrevMoon ) ), Dot( eMoon, ePrevMoon ) ) );
+      }
+
+      ePrevMoon = eMoon;
+    }
+
+    if( i ) {
+      AstMotion = std::max( AstMotion, atan2( Norm( Cross( eAst, ePrevAst ) ), Dot( eAst, ePrevAst ) ) );
+    }
+
+    ePrevAst = eAst;
+  }
+
+  // Between points and after the last one elongation differs from its value at a point by one step motion at most
+  if( ( MinSunElong > 0.0 ) &&
+      ( apsmathlib::Deg * ( SunElong + AstMotion ) + SUN_ELONG_MARGIN < MinSunElong ) ) {
+    return( true );
+  }
+
+  if( ( MinMoonElong > 0.0 ) &&
+      ( apsmathlib::Deg * ( MoonElong + AstMotion + MoonMotion ) + MOON_ELONG_MARGIN < MinMoonElong ) ) {
+    return( true );
+  }
+
+  return( false );
+}
+
+short LOCalc :: GetStarMaxMv( const LOAsteroid * pLOAsteroid, const double BeginMjdate, const double EndMjdate,
+                              const int ScanStep ) const
+{
+  APSVec3d rAstAU;
+  double   MinDrop;
+  double   Brightness;
+  double   MaxMv;
+  int      i;
+
+  MinDrop = pModule->GetCalcMinDrop();
+
+  if( IfSiteLimits && ( SiteMinDrop - SITE_DROP_MARGIN > MinDrop ) ) {
+    MinDrop = SiteMinDrop - SITE_DROP_MARGIN;
+  }
+
+  if( MinDrop <= 0.0 ) {
+    return( SiteMaxMv );
+  }
+
+  // Drop grows with the asteroid magnitude, so the fainter end of the window is taken
+  rAstAU     = APSVec3d( ChebValues[ 0 ], ChebValues[ 1 ], ChebValues[ 2 ] / fac );
+  Brightness = CalculateBrightness( pLOAsteroid, SunEquPos( GetETMjdate( BeginMjdate ) ), rAstAU );
+
+  i          = 3 * ( ScanStep - 1 );
+  rAstAU     = APSVec3d( ChebValues[ i ], ChebValues[ i + 1 ], ChebValues[ i + 2 ] / fac );
+  Brightness = std::max( Brightness, CalculateBrightness( pLOAsteroid, SunEquPos( GetETMjdate( EndMjdate ) ), rAstAU ) );
+
+  // CalculateBrightDelta( MaxMv, Brightness ) == MinDrop
+  MaxMv = Brightness + DROP_MV_MARGIN - log10( pow( 2.512, MinDrop ) - 1.0 ) / log10( 2.512 );
+
+  if( !( MaxMv * 100.0 < SiteMaxMv ) ) {
+    return( SiteMaxMv );
+  }
+
+  return( static_cast<short>( ceil( MaxMv * 100.0 ) ) );
+}
+
 //-------------------------------------------------------------------------------------------
     
 //*********************************************************
@@ -695,7 +1259,7 @@ void LOCalc :: CalcParallax( const LOStar * pLOStar, const double ETMjdate, cons
   double sinParallaxAlpha = sin( pLOStar->GetRA() );
   double cosParallaxAlpha = cos( pLOStar->GetRA() );
 
-  APSVec3d rEarthBary = ephem->EarthBaryEquPos( ETMjdate );
+  APSVec3d rEarthBary = EarthBaryEquPos( ETMjdate );
 
   ParallaxDelta = Parallax * ( rEarthBary[ apsmathlib::x ] * sinParallaxDelta * cosParallaxAlpha +
                                rEarthBary[ apsmathlib::y ] * sinParallaxDelta * sinParallaxAlpha -
@@ -823,15 +1387,11 @@ int LOCalc :: ProcessStar( const LOAsteroid * pLOAsteroid, const APSVec3d * r_As
 
 //----- Precessing and nutation -------
 
-    double T = ( ETMjdate - apsastroalg::MJD_J2000 ) / 36525.0;
-
-    r = apsastroalg::PrecMatrix_Equ( apsastroalg::T_J2000, T ) * r;
-
-    r = apsastroalg::NutMatrix( T ) * r;
+    r = GetEquToTrueMatrix( ETMjdate ) * r;
 
 //-------------------------------------
 
-    r_G    = apsmathlib::R_z( apsastroalg::GMST( Mjdate + pModule->GetUT_UTC() + apsastroalg::equequ( T ) ) ) * r;                    // Greenwich coordinates
+    r_G    = apsmathlib::R_z( apsastroalg::GMST( Mjdate + pModule->GetUT_UTC() + GetEquEqu( ETMjdate ) ) ) * r;                    // Greenwich coordinates
     Lambda = apsmathlib::Modulo( r_G[ apsmathlib::phi ] + apsmathlib::pi , 2 * apsmathlib::pi ) - apsmathlib::pi;      // East longitude
     Phi    = r_G[ apsmathlib::theta ];                                 // Geocentric latitude
     Phi    = Phi + 0.1924 * apsmathlib::Rad * sin( 2 * Phi );          // Geographic latitude
@@ -874,7 +1434,7 @@ int LOCalc :: ProcessStar( const LOAsteroid * pLOAsteroid, const APSVec3d * r_As
                      "mas ParallaxAlpha = " << std::fixed << std::setprecision(3) << std::setw(7) << apsmathlib::Deg * 1000.0 * 3600.0 * ParallaxAlpha <<
                      "mas ParallaxDelta = " << std::fixed << std::setprecision(3) << std::setw(7) << apsmathlib::Deg * 1000.0 * 3600.0 * ParallaxDelta << "mas" << std::endl;
 
-APSVec3d rEarthBary = ephem->EarthBaryEquPos( ETMjdate );
+APSVec3d rEarthBary = EarthBaryEquPos( ETMjdate );
 std::cout << " rEarthBary[ x ] = " << std::fixed << std::setprecision(6) << std::setw(8) << rEarthBary[ apsmathlib::x ] <<
              " rEarthBary[ y ] = " << std::fixed << std::setprecision(6) << std::setw(8) << rEarthBary[ apsmathlib::y ] <<
              " rEarthBary[ z ] = " << std::fixed << std::setprecision(6) << std::setw(8) << rEarthBary[ apsmathlib::z ] << std::endl;
@@ -901,8 +1461,8 @@ std::cout << " rEarthBary[ x ] = " << std::fixed << std::setprecision(6) << std:
         double Brightness;
         double BrightDelta;
 
-        APSVec3d  R_Sun  = ephem->SunEquPos( ETMjdate );  // In AU !!!
-        APSVec3d  R_Moon = ephem->MoonEquPos( ETMjdate ); // In AU !!!
+        APSVec3d  R_Sun  = SunEquPos( ETMjdate );  // In AU !!!
+        APSVec3d  R_Moon = MoonEquPos( ETMjdate ); // In AU !!!
 
         Brightness = CalculateBrightness( pLOAsteroid, R_Sun, rAstAU );
 
@@ -1061,7 +1621,7 @@ std::cout << " rEarthBary[ x ] = " << std::fixed << std::setprecision(6) << std:
       double   Phi2    = std::numeric_limits<double>::max();
       double   Durat   = 0.0;
       APSVec3d R_Obs   = apsastroalg::Site( Lambda, Phi );
-      APSVec3d R_Sun   = ephem->SunEquPos( ETMjdate );  // AU*SunEqu( ( ETMjdate - MJD_J2000 ) / 36525.0 );
+      APSVec3d R_Sun   = SunEquPos( ETMjdate );  // AU*SunEqu( ( ETMjdate - MJD_J2000 ) / 36525.0 );
 
       if( t_prev != Mjdate ) {
         APSVec3d r_now = rAst + s0 * eStar;
@@ -1183,8 +1743,8 @@ std::cout << " rEarthBary[ x ] = " << std::fixed << std::setprecision(6) << std:
           double Brightness;
           double BrightDelta;
 
-          APSVec3d  R_Sun  = ephem->SunEquPos( ETMjdate );  // In AU !!!
-          APSVec3d  R_Moon = ephem->MoonEquPos( ETMjdate ); // In AU !!!
+          APSVec3d  R_Sun  = SunEquPos( ETMjdate );  // In AU !!!
+          APSVec3d  R_Moon = MoonEquPos( ETMjdate ); // In AU !!!
 
           Brightness = CalculateBrightness( pLOAsteroid, R_Sun, rAstAU );
 
@@ -1270,7 +1830,7 @@ int LOCalc :: CalculateParameters( const LOAsteroid * pLOAsteroid, const LOStar
                                    double & Brightness, double & BrightDelta, double & Uncertainty,
                                    double & AngleUncertainty ) const
 {
-  apsmathlib::APSCheb * pAPSCheb;
+  apsmathlib::APSChebEval<SAVE_CHEB_ORDER> Cheb;
   APSVec3d              eStar;
   APSVec3d              rAstAU;
   APSVec3d              rAst;
@@ -1283,7 +1843,6 @@ int LOCalc :: CalculateParameters( const LOAsteroid * pLOAsteroid, const LOStar
   double                ParallaxDelta = 0.0;
   double                ParallaxAlpha = 0.0;
   double                s0;
-  bool                  valid;
   double                ra;
   double                de;
   double                plx;
@@ -1292,16 +1851,12 @@ int LOCalc :: CalculateParameters( const LOAsteroid * pLOAsteroid, const LOStar
   double                VR;
   int                   RetCode = 0;
 
-  pAPSCheb = new apsmathlib::APSCheb( pModule->GetChebSubModulePtr(), ChebOrder, cX, cY, cZ, BeginOccTime, EndOccTime );
+  Cheb.Set( ChebOrder, cX, cY, cZ, BeginOccTime, EndOccTime );
 
   Mjdate = ( BeginOccTime + EndOccTime ) / 2.0;
 
-  if( !pAPSCheb->Value( Mjdate, r_equ ) ) {
-    apsastroalg::ETminUT( ( Mjdate - apsastroalg::MJD_J2000 )/36525.0, ET_UT, valid );
-
-    if( !valid ) {
-      ET_UT = pModule->GetET_UT();
-    }
+  if( !Cheb.Value( Mjdate, r_equ ) ) {
+    ET_UT = GetETminUT( Mjdate );
 
     Parallax = pLOStar->GetParallax();
 
@@ -1341,15 +1896,14 @@ int LOCalc :: CalculateParameters( const LOAsteroid * pLOAsteroid, const LOStar
 
     eStar = eStar / eStarDist;
 
-    APSVec3d R_Sun  = ephem->SunEquPos( ETMjdate );  // In AU !!!
-    APSVec3d R_Moon = ephem->MoonEquPos( ETMjdate ); // In AU !!!
+    APSVec3d R_Sun  = SunEquPos( ETMjdate );  // In AU !!!
+    APSVec3d R_Moon = MoonEquPos( ETMjdate ); // In AU !!!
 
     rAstAU = APSVec3d( r_equ[ apsmathlib::x ], r_equ[ apsmathlib::y ], r_equ[ apsmathlib::z ] / fac );
 
     Brightness = CalculateBrightness( pLOAsteroid, R_Sun, rAstAU );
 
-    BrightDelta = log10( pow( 2.512, pLOStar->GetMv() / 100.0 ) +
-                         pow( 2.512, Brightness ) ) / log10( 2.512 ) - pLOStar->GetMv() / 100.0;
+    BrightDelta = CalculateBrightDelta( pLOStar->GetMv(), Brightness );
 
     MoonPhase = 50.0 * ( 1 + ( Dot( -R_Moon, R_Sun - R_Moon ) / ( Norm( R_Sun - R_Moon ) * Norm( R_Moon ) ) ) );
 
@@ -1373,8 +1927,6 @@ int LOCalc :: CalculateParameters( const LOAsteroid * pLOAsteroid, const LOStar
     RetCode = 1;
   }
 
-  delete pAPSCheb;
-
   return( RetCode );
 }
 
@@ -1424,7 +1976,7 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
                                       const double MoonPhase, const double SunDist, const double MoonDist,
                                       const double Brightness, const double BrightDelta, const double Uncertainty ) const
 {
-  apsmathlib::APSCheb * pAPSCheb;
+  apsmathlib::APSChebEval<SAVE_CHEB_ORDER> Cheb;
   APSVec3d              r_equ;
   APSVec3d              rAst;
   APSVec3d              eStar;
@@ -1445,7 +1997,6 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
   double                r0;
   double                Duration;
   int                   PrevFlag;
-  bool                  valid;
 
   std::cout << "------------------------ Start event -------------------------------" << std::endl;
 
@@ -1453,15 +2004,11 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
                Catalogue, StarNumber, Mv, BeginOccTime, EndOccTime, EarthFlag, MaxDuration,
                StarRA, StarDec, MoonPhase, SunDist, MoonDist, Brightness, BrightDelta, Uncertainty );
 
-  pAPSCheb = new apsmathlib::APSCheb( pModule->GetChebSubModulePtr(), ChebOrder, cX, cY, cZ, BeginOccTime, EndOccTime );
+  Cheb.Set( ChebOrder, cX, cY, cZ, BeginOccTime, EndOccTime );
 
   Mjdate = ( BeginOccTime + EndOccTime ) / 2.0;
 
-  apsastroalg::ETminUT( ( Mjdate - apsastroalg::MJD_J2000 ) / 36525.0, ET_UT, valid );
-
-  if( !valid ) {
-    ET_UT = pModule->GetET_UT();
-  }
+  ET_UT = GetETminUT( Mjdate );
 
   ETMjdate = Mjdate + ET_UT / 86400.0;
 
@@ -1482,9 +2029,12 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
   PrevFlag = 0;
   Duration = 0.0;
 
-  double T = ( Mjdate - apsastroalg::MJD_J2000 ) / 36525.0;
+  APSMat3d PrecMat = GetEquToTrueMatrix( Mjdate );
+
+  // Sun direction at ETMjdate for all points of the path
+  APSVec3d R_Sun = SunEquPos( ETMjdate );
 
-  APSMat3d PrecMat = apsastroalg::NutMatrix( T ) * apsastroalg::PrecMatrix_Equ( apsastroalg::T_J2000, T );
+  R_Sun = R_Sun / Norm( R_Sun );
 
   if( pModule->GetOutputType() == 0 ) {
     std::cout << "     Date/Time          Long                    Lat               Star alt Sun alt   Durat" << std::endl;
@@ -1496,7 +2046,7 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
   }
 
   while( Mjdate <= EndOccTime ) {
-    if( pAPSCheb->Value( Mjdate, r_equ ) ) {
+    if( Cheb.Value( Mjdate, r_equ ) ) {
       std::cout << "ERROR: PrintOccultationEvent - pAPSCheb->Value1" << std::endl;
       std::cout << "Mjdate = " << std::fixed << Mjdate << " BeginOccTime = " << std::fixed << BeginOccTime << std::endl;
       break;
@@ -1529,7 +2079,6 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
       double   StarElev;
       double   SunElev;
       APSVec3d R_Obs = apsastroalg::Site( Lambda, Phi );
-      APSVec3d R_Sun = ephem->SunEquPos( ETMjdate );
 
       R_Obs = apsmathlib::R_z( -apsastroalg::GMST( Mjdate ) ) * R_Obs;
 
@@ -1537,8 +2086,6 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
       
       StarElev = asin( Dot( R_Obs , eStar ) );
 
-      R_Sun = R_Sun / Norm( R_Sun );
-
       SunElev = asin( Dot( R_Obs, R_Sun ) );
 
       if( PrevFlag ) {
@@ -1632,8 +2179,6 @@ void LOCalc :: PrintOccultationEvent( const double TimeStep, const int AsteroidI
   }
 
   std::cout << "--------------------------- End event ---------------------------------" << std::endl;
-
-  delete pAPSCheb;
 }
 
 double LOCalc :: CalculateDistance( const double ObserverLongitude, const double ObserverLatitude,
@@ -1732,12 +2277,13 @@ void LOCalc :: IfDistanceCheb( const double TimeStep, const double ObserverLongi
                                const double ET_UT, const double BeginOccTime, const double EndOccTime,
                                const int EarthFlag, const double StarRA, const double StarDec ) const
 {
-  apsmathlib::APSCheb * pAPSCheb;
-  APSVec3d              r_equ;
-  APSVec3d              rAst;
-  APSVec3d              eStar;
-  APSVec3d              r_G;
-  APSVec3d              r;
+  apsmathlib::APSChebEval<SAVE_CHEB_ORDER> Cheb;
+  APSVec3d              ePolar;
+  APSVec3               r_equ;
+  APSVec3               rAst;
+  APSVec3               eStar;
+  APSVec3               r_G;
+  APSVec3               r;
   double                Mjdate;
   double                ETMjdate;
   double                Lambda;
@@ -1751,10 +2297,10 @@ void LOCalc :: IfDistanceCheb( const double TimeStep, const double ObserverLongi
 
   MaxDistance = std::numeric_limits<double>::max();
 
-  pAPSCheb = new apsmathlib::APSCheb( pModule->GetChebSubModulePtr(), ChebOrder, cX, cY, cZ, BeginOccTime, EndOccTime );
+  Cheb.Set( ChebOrder, cX, cY, cZ, BeginOccTime, EndOccTime );
 
-  eStar = APSVec3d( apsmathlib::Polar( StarRA, StarDec ) );
-  eStar = APSVec3d( eStar[ apsmathlib::x ], eStar[ apsmathlib::y ], eStar[ apsmathlib::z ] / fac );
+  ePolar = APSVec3d( apsmathlib::Polar( StarRA, StarDec ) );
+  eStar  = APSVec3( ePolar[ apsmathlib::x ], ePolar[ apsmathlib::y ], ePolar[ apsmathlib::z ] / fac );
 
   eStarDist = Norm( eStar );
 
@@ -1762,17 +2308,15 @@ void LOCalc :: IfDistanceCheb( const double TimeStep, const double ObserverLongi
 
   Mjdate = BeginOccTime;
 
-  double T = ( Mjdate - apsastroalg::MJD_J2000 ) / 36525.0;
-
-  APSMat3d PrecMat = apsastroalg::NutMatrix( T ) * apsastroalg::PrecMatrix_Equ( apsastroalg::T_J2000, T );
+  APSMat3 PrecMat( GetEquToTrueMatrix( Mjdate ) );
 
   while( Mjdate <= EndOccTime ) {
-    if( pAPSCheb->Value( Mjdate, r_equ ) ) {
+    if( Cheb.Value( Mjdate, r_equ.v ) ) {
       std::cout << "ERROR: IfDistance - pAPSCheb->Value1" << std::endl;
       break;
     }
 
-    rAst = GetAU() * APSVec3d( r_equ[ apsmathlib::x ], r_equ[ apsmathlib::y ], r_equ[ apsmathlib::z ] / fac );
+    rAst = GetAU() * APSVec3( r_equ[ apsmathlib::x ], r_equ[ apsmathlib::y ], r_equ[ apsmathlib::z ] / fac );
 
     s0 = -Dot( rAst, eStar );
 
@@ -1783,7 +2327,7 @@ void LOCalc :: IfDistanceCheb( const double TimeStep, const double ObserverLongi
       s = s0 + sqrt( Delta ); //s = s0 - sqrt( Delta );
       r = rAst + s * eStar;
 
-      r = APSVec3d( r[ apsmathlib::x ], r[ apsmathlib::y ], fac * r[ apsmathlib::z ] );
+      r = APSVec3( r[ apsmathlib::x ], r[ apsmathlib::y ], fac * r[ apsmathlib::z ] );
 
 //----- Precessing and nutation -------
 
@@ -1791,9 +2335,9 @@ void LOCalc :: IfDistanceCheb( const double TimeStep, const double ObserverLongi
 
 //-------------------------------------
 
-      r_G    = apsmathlib::R_z( apsastroalg::GMST( Mjdate ) ) * r;                    // Greenwich coordinates
-      Lambda = apsmathlib::Modulo( r_G[ apsmathlib::phi ] + apsmathlib::pi , 2 * apsmathlib::pi ) - apsmathlib::pi;      // East longitude
-      Phi    = r_G[ apsmathlib::theta ];                                 // Geocentric latitude
+      r_G    = apsmathlib::Mat3R_z( apsastroalg::GMST( Mjdate ) ) * r;                 // Greenwich coordinates
+      Lambda = apsmathlib::Modulo( Azimuth( r_G ) + apsmathlib::pi , 2 * apsmathlib::pi ) - apsmathlib::pi;      // East longitude
+      Phi    = Altitude( r_G );                                          // Geocentric latitude
       Phi    = Phi + 0.1924 * apsmathlib::Rad * sin( 2 * Phi );          // Geographic latitude
 
       Distance = CalculateDistance( ObserverLongitude, ObserverLatitude, Lambda, Phi );
@@ -1810,13 +2354,13 @@ void LOCalc :: IfDistanceCheb( const double TimeStep, const double ObserverLongi
   }
 
   if( MaxDistance != std::numeric_limits<double>::max() ) {
-    ETMjdate = MaxMjdate + ET_UT / 86400.0;
+    ETMjdate = GetETMjdate( MaxMjdate );
 
-    APSVec3d R_Sun   = ephem->SunEquPos( ETMjdate );
-    APSVec3d R_Moon =  ephem->MoonEquPos( ETMjdate ); // In AU !!!
-    APSVec3d R_Obs   = apsastroalg::Site( ObserverLongitude, ObserverLatitude );
+    APSVec3 R_Sun( SunEquPos( ETMjdate ) );
+    APSVec3 R_Moon( MoonEquPos( ETMjdate ) ); // In AU !!!
+    APSVec3 R_Obs( apsastroalg::Site( ObserverLongitude, ObserverLatitude ) );
 
-    R_Obs = apsmathlib::R_z( -apsastroalg::GMST( MaxMjdate ) ) * R_Obs;
+    R_Obs = apsmathlib::Mat3R_z( -apsastroalg::GMST( MaxMjdate ) ) * R_Obs;
 
     R_Obs = R_Obs / Norm( R_Obs );
 
@@ -1830,8 +2374,6 @@ void LOCalc :: IfDistanceCheb( const double TimeStep, const double ObserverLongi
 
     MoonElev = asin( Dot( R_Obs, R_Moon ) );
   }
-
-  delete pAPSCheb;
 }
 
 void LOCalc :: IfDistance( const double TimeStep, const double ObserverLongitude, const double ObserverLatitude,
@@ -1863,7 +2405,7 @@ void LOCalc :: IfDistance( const double TimeStep, const double ObserverLongitude
 
   pLOAstOrbCalc = new LOAstOrbCalc( pModule->GetAstOrbSubModulePtr(), apsastroalg::APS_INTEGRATION_DE,
                                     ephem, ObservationEpoch,
-                                    M, W, O, I, E, A, ET_UT, 0.0, 0.0 );
+                                    M, W, O, I, E, A, ET_UT, 0.0, 0.0, pDeltaT );
 
   eStar = APSVec3d( apsmathlib::Polar( StarRA, StarDec ) );
   eStar = APSVec3d( eStar[ apsmathlib::x ], eStar[ apsmathlib::y ], eStar[ apsmathlib::z ] / fac );
@@ -1874,9 +2416,7 @@ void LOCalc :: IfDistance( const double TimeStep, const double ObserverLongitude
 
   Mjdate = BeginOccTime;
 
-  double T = ( Mjdate - apsastroalg::MJD_J2000 ) / 36525.0;
-
-  APSMat3d PrecMat = apsastroalg::NutMatrix( T ) * apsastroalg::PrecMatrix_Equ( apsastroalg::T_J2000, T );
+  APSMat3d PrecMat = GetEquToTrueMatrix( Mjdate );
 
   while( Mjdate <= EndOccTime ) {
     if( pLOAstOrbCalc->ProcessAsteroid( Mjdate, r_equ ) ) {
@@ -1922,10 +2462,10 @@ void LOCalc :: IfDistance( const double TimeStep, const double ObserverLongitude
   }
 
   if( MaxDistance != std::numeric_limits<double>::max() ) {
-    ETMjdate = MaxMjdate + ET_UT / 86400.0;
+    ETMjdate = GetETMjdate( MaxMjdate );
 
-    APSVec3d R_Sun  = ephem->SunEquPos( ETMjdate );
-    APSVec3d R_Moon = ephem->MoonEquPos( ETMjdate ); // In AU !!!
+    APSVec3d R_Sun  = SunEquPos( ETMjdate );
+    APSVec3d R_Moon = MoonEquPos( ETMjdate ); // In AU !!!
     APSVec3d R_Obs  = apsastroalg::Site( MaxLongitude, MaxLatitude );
 
     R_Obs = apsmathlib::R_z( -apsastroalg::GMST( MaxMjdate ) ) * R_Obs;
@@ -2039,7 +2579,7 @@ void LOCalc :: SaveOccEvent( const int AsteroidID, const std::string & AsteroidN
 int LOCalc :: SaveOccultationEvent( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar,
                                     LOEventData * pLOEventData,
                                     const double BeginOccTime, const double EndOccTime,
-                                    const int EarthFlag, const double MaxDuration, const double ET_UT ) const
+                                    const int EarthFlag, const double MaxDuration ) const
 {
   LOAstOrbChebMaker * pLOAstOrbChebMaker;
   double              cX[ SAVE_CHEB_ORDER + 1 ];
@@ -2054,13 +2594,17 @@ int LOCalc :: SaveOccultationEvent( const LOAsteroid * pLOAsteroid, const LOStar
   double              BrightDelta;
   double              Uncertainty;
   double              AngleUncertainty;
+  double              ET_UT;
   int                 RetCode = 0;
 
+  // Saved with the event for its output and rerun
+  ET_UT = GetETminUT( ( BeginOccTime + EndOccTime ) / 2.0 );
+
   pLOAstOrbChebMaker = new LOAstOrbChebMaker( pModule->GetChebMakerSubModulePtr(), 
                                               ephem, pLOAsteroid->GetObservationEpoch(),
                                               pLOAsteroid->GetM(), pLOAsteroid->GetW(), pLOAsteroid->GetO(),
                                               pLOAsteroid->GetI(), pLOAsteroid->GetE(), pLOAsteroid->GetA(),
-                                              ET_UT, 0.0, 0.0);
+                                              ET_UT, 0.0, 0.0, pDeltaT );
 
   pLOAstOrbChebMaker->Create( SAVE_CHEB_ORDER, BeginOccTime, EndOccTime, cX, cY, cZ );
 
@@ -2107,11 +2651,17 @@ int LOCalc :: SaveOccultationEvent( const LOAsteroid * pLOAsteroid, const LOStar
 double LOCalc ::  CalcDuration( const APSVec3d & eStar, const double Diameter, const APSVec3d & r,
                                 const APSVec3d & r_prev, const double SmallStep ) const
 {
-  APSVec3d  dr;
+  return( CalcDuration( APSVec3( eStar ), Diameter, APSVec3( r ), APSVec3( r_prev ), SmallStep ) );
+}
+
+double LOCalc ::  CalcDuration( const APSVec3 & eStar, const double Diameter, const APSVec3 & r,
+                                const APSVec3 & r_prev, const double SmallStep ) const
+{
+  APSVec3   dr;
   double    drp;
   double    Duration;
 
-  dr = APSVec3d( r_prev[ apsmathlib::x ] - r[ apsmathlib::x ] + apsmathlib::pi2 * 1.002738 * r[ apsmathlib::y ] * SmallStep,
+  dr = APSVec3( r_prev[ apsmathlib::x ] - r[ apsmathlib::x ] + apsmathlib::pi2 * 1.002738 * r[ apsmathlib::y ] * SmallStep,
                  r_prev[ apsmathlib::y ] - r[ apsmathlib::y ] - apsmathlib::pi2 * 1.002738 * r[ apsmathlib::x ] * SmallStep,
                  r_prev[ apsmathlib::z ] - r[ apsmathlib::z ] );
 
@@ -2130,8 +2680,9 @@ double LOCalc ::  CalcDuration( const APSVec3d & eStar, const double Diameter, c
 
 int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar,
                                       LOEventData * pLOEventData,
-                                      const APSVec3d & eStar, double * StartMjdate, int * StartStep,
-                                      const double ET_UT, const double Step, const double MaxDist ) const
+                                      const APSVec3 & eStar, double * StartMjdate, int * StartStep,
+                                      const double Step, const double MaxDist,
+                                      const double ApproachMjdate ) const
 {
   LOAstOrbCalc * pLOAstOrbCalc;
   int            SmallCurrentStep;
@@ -2140,9 +2691,14 @@ int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOSt
   //double         ETMjdate;
   double         LimitDate;
   APSVec3d       r_equ;
-  APSVec3d       rAst;
-  APSVec3d       r;
-  APSVec3d       r_prev;
+  APSVec3        rAst;
+  APSVec3        r;
+  APSVec3        r_prev( 0.0, 0.0, 0.0 );
+  APSVec3        rClosest( 0.0, 0.0, 0.0 );
+  APSVec3        SunDir( 0.0, 0.0, 0.0 );
+  double         MinR0 = std::numeric_limits<double>::max();
+  double         MinTrackSunElev = std::numeric_limits<double>::max();
+  double         TrackSunElev;
   double         s0;
   double         s;
   double         Delta;
@@ -2166,7 +2722,7 @@ int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOSt
                                     ephem, pLOAsteroid->GetObservationEpoch(),
                                     pLOAsteroid->GetM(), pLOAsteroid->GetW(), pLOAsteroid->GetO(),
                                     pLOAsteroid->GetI(), pLOAsteroid->GetE(), pLOAsteroid->GetA(),
-                                    ET_UT, 0.0, 0.0 );
+                                    pModule->GetET_UT(), 0.0, 0.0, pDeltaT );
 
   EarthFlag        = 0;
   PrevFlag         = 0;
@@ -2175,22 +2731,33 @@ int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOSt
   LimitDate        = Mjdate + 2 * Step;
   MaxDuration      = 0.0;
 
+  if( IfSiteLimits ) {
+    // Sun does not move noticeably during the event
+    SunDir = APSVec3( SunEquPos( GetETMjdate( Mjdate ) ) );
+    SunDir = SunDir / Norm( SunDir );
+  }
+
   // If occultation starts on previous day, do something.
 
   do {
     if( pLOAstOrbCalc->ProcessAsteroid( Mjdate, r_equ ) ) {
-      std::cout << "ERROR: CreateOccultationEvent ProcessAsteroid" << std::endl;
+      PrintMessage( "ERROR: CreateOccultationEvent ProcessAsteroid\n" );
       RetCode = 1;
       break;
     }
 
-    rAst = GetAU() * APSVec3d( r_equ[ apsmathlib::x ], r_equ[ apsmathlib::y ], r_equ[ apsmathlib::z ] / fac );
+    rAst = GetAU() * APSVec3( r_equ[ apsmathlib::x ], r_equ[ apsmathlib::y ], r_equ[ apsmathlib::z ] / fac );
 
     s0 = -Dot( rAst, eStar );
 
     r0 = sqrt( Dot( rAst, rAst ) - s0 * s0 );
 
     if( r0 < MaxDist ) {
+      if( r0 < MinR0 ) {
+        MinR0    = r0;
+        rClosest = rAst;
+      }
+
       if( r0 < apsastroalg::R_Earth ) {
         EarthFlag = 1;
 
@@ -2198,7 +2765,15 @@ int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOSt
         s = s0 + sqrt( Delta );
         r = rAst + s * eStar;
 
-        r = APSVec3d( r[ apsmathlib::x ], r[ apsmathlib::y ], fac * r[ apsmathlib::z ] );
+        r = APSVec3( r[ apsmathlib::x ], r[ apsmathlib::y ], fac * r[ apsmathlib::z ] );
+
+        if( IfSiteLimits ) {
+          TrackSunElev = asin( Dot( r, SunDir ) / Norm( r ) );
+
+          if( TrackSunElev < MinTrackSunElev ) {
+            MinTrackSunElev = TrackSunElev;
+          }
+        }
 
         if( PrevFlag ) {
           Duration = CalcDuration( eStar, pLOAsteroid->GetDiameter(), r, r_prev, SmallStep );
@@ -2235,8 +2810,10 @@ int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOSt
 
     if( !BeginOccFlag ) {
       if( Mjdate > LimitDate ) {
-        std::cout << "ERROR: Mjdate > LimitDate" << std::endl;
-        std::cout << "Mjdate = " << Mjdate << " LimitDate = " << LimitDate << std::endl;
+        std::ostringstream Msg;
+        Msg << "ERROR: Mjdate > LimitDate" << std::endl;
+        Msg << "Mjdate = " << Mjdate << " LimitDate = " << LimitDate << std::endl;
+        PrintMessage( Msg.str() );
         RetCode = 2;
         break;
       }
@@ -2245,18 +2822,34 @@ int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOSt
 
   if( !RetCode ) {
     if( BeginOccTime < EndOccTime ) {
-      RetCode = SaveOccultationEvent( pLOAsteroid, pLOStar, pLOEventData, BeginOccTime, EndOccTime, EarthFlag, MaxDuration, ET_UT );
+      if( !IfSiteLimits ||
+          IfSiteAccepted( pLOAsteroid, pLOStar, ( rClosest / GetAU() ).GetAPSVec3d(), GetETMjdate( BeginOccTime ),
+                          EarthFlag, MaxDuration, MinTrackSunElev ) ) {
+        if( pChunkEvents ) { // Saved by ProcessTimeChunks in chunk order
+          LOChunkEvent ChunkEvent = { pLOStar, ApproachMjdate, BeginOccTime, EndOccTime, EarthFlag, MaxDuration };
 
-      //cout << DateTime( BeginOccTime, HHMMSS ) << endl;
-      //cout << DateTime( EndOccTime, HHMMSS ) << endl;
+          pChunkEvents->push_back( ChunkEvent );
+        }
+        else {
+          RetCode = SaveOccultationEvent( pLOAsteroid, pLOStar, pLOEventData, BeginOccTime, EndOccTime, EarthFlag, MaxDuration );
 
-      if( RetCode ) {
-        std::cout << "ERROR: SaveOccultationEvent" << std::endl;
+          //cout << DateTime( BeginOccTime, HHMMSS ) << endl;
+          //cout << DateTime( EndOccTime, HHMMSS ) << endl;
+
+          if( RetCode ) {
+            PrintMessage( "ERROR: SaveOccultationEvent\n" );
+          }
+        }
+      }
+      else {
+        SiteRejectedEvents++;
       }
     }
     else {
-      std::cout << "WARNING: BeginOccTime >= EndOccTime" << std::endl;
-      std::cout << "BeginOccTime = " << std::fixed << BeginOccTime << " EndOccTime = " << std::fixed << EndOccTime << std::endl;
+      std::ostringstream Msg;
+      Msg << "WARNING: BeginOccTime >= EndOccTime" << std::endl;
+      Msg << "BeginOccTime = " << std::fixed << BeginOccTime << " EndOccTime = " << std::fixed << EndOccTime << std::endl;
+      PrintMessage( Msg.str() );
       RetCode = 3;
     }
   }
@@ -2272,14 +2865,133 @@ int LOCalc :: CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOSt
   return( RetCode );
 }
 
+int LOCalc :: FindStarEvent( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar, const LOEventData * pLOEventData,
+                             const double Mjdate, double & EndOccTime ) const
+{
+  const LOEvent * pLOEvent;
+  unsigned int    i;
+
+  if( pChunkEvents ) {
+    i = pChunkEvents->size();
+
+    while( i > 0 ) { // the latest events first
+      i--;
+
+      const LOChunkEvent & ChunkEvent = ( *pChunkEvents )[ i ];
+
+      if( ( ChunkEvent.pLOStar->GetCatalogue() == pLOStar->GetCatalogue() ) &&
+          ( ChunkEvent.pLOStar->GetStarNumber() == pLOStar->GetStarNumber() ) &&
+          ( Mjdate >= ChunkEvent.BeginOccTime ) && ( Mjdate <= ChunkEvent.EndOccTime ) ) {
+        EndOccTime = ChunkEvent.EndOccTime;
+        return( 1 );
+      }
+    }
+
+    return( 0 );
+  }
+
+  pLOEvent = pLOEventData->FindEvent( pLOAsteroid->GetAsteroidID(), pLOStar->GetCatalogue(), pLOStar->GetStarNumber(), Mjdate );
+
+  if( pLOEvent ) {
+    EndOccTime = pLOEvent->GetEndOccTime();
+    return( 1 );
+  }
+
+  return( 0 );
+}
+
+void LOCalc :: PrintMessage( const std::string & Text ) const
+{
+  if( pChunkMessages ) {
+    LOChunkMessage ChunkMessage = { 0, Text };
+
+    pChunkMessages->push_back( ChunkMessage );
+  }
+  else {
+    std::cout << Text << std::flush;
+  }
+}
+
+void LOCalc :: InfoMessage( const int Code, const std::string & Text ) const
+{
+  if( pChunkMessages ) {
+    LOChunkMessage ChunkMessage = { Code, Text };
+
+    pChunkMessages->push_back( ChunkMessage );
+  }
+  else {
+    pModule->InfoMessage( Code, Text );
+  }
+}
+
+double LOCalc :: GetShadowDistance( const APSVec3 & eStar, const int CurrentStep ) const
+{
+  APSVec3 rAst;
+  double  s0;
+
+  // Same values as in ProcessStar1
+  rAst = GetAU() * APSVec3( ChebValues[ 3 * CurrentStep ], ChebValues[ 3 * CurrentStep + 1 ], ChebValues[ 3 * CurrentStep + 2 ] / fac );
+
+  s0 = Dot( rAst, eStar );
+
+  return( sqrt( std::max( Dot( rAst, rAst ) - s0 * s0, 0.0 ) ) );
+}
+
+void LOCalc :: FindShadowRuns( const APSVec3 & eStar, const int FirstStep, const int LastStep, const int ScanStep,
+                               const double Limit, int * pRuns, int & RunsNumber ) const
+{
+  double r0;
+  int    MiddleStep;
+
+  MiddleStep = ( FirstStep + LastStep ) / 2;
+
+  r0 = GetShadowDistance( eStar, MiddleStep );
+
+  // Distance of the axis changes not faster than the asteroid moves
+  if( r0 - ChebStepBound * std::max( MiddleStep - FirstStep, LastStep - MiddleStep ) >= Limit ) {
+    return;
+  }
+
+  if( LastStep - FirstStep > 1 ) {
+    FindShadowRuns( eStar, FirstStep, MiddleStep, ScanStep, Limit, pRuns, RunsNumber );
+    FindShadowRuns( eStar, MiddleStep, LastStep, ScanStep, Limit, pRuns, RunsNumber );
+    return;
+  }
+
+  // The axis can't come closer between two points than their mean distance minus half of the motion
+  if( ( LastStep < ScanStep ) && ( 0.5 * ( r0 + GetShadowDistance( eStar, LastStep ) - ChebStepBound ) >= Limit ) ) {
+    return;
+  }
+
+  if( RunsNumber && ( pRuns[ 2 * RunsNumber - 1 ] == FirstStep ) ) {
+    pRuns[ 2 * RunsNumber - 1 ] = LastStep;
+  }
+  else if( RunsNumber < MAX_SHADOW_RUNS ) {
+    pRuns[ 2 * RunsNumber ]     = FirstStep;
+    pRuns[ 2 * RunsNumber + 1 ] = LastStep;
+    RunsNumber++;
+  }
+  else {
+    pRuns[ 2 * RunsNumber - 1 ] = LastStep; // The gap is searched with the last run
+  }
+}
+
 int LOCalc :: ProcessStar1( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar, LOEventData * pLOEventData,
-                            const double BeginMjdate, const double EndMjdate, const double ET_UT,
+                            const double BeginMjdate, const double EndMjdate,
                             const double Step, const int ScanStep )
 {
-  APSVec3d        eStar;
-  APSVec3d        rAst;
-  APSVec3d        rAstAU;
+  APSVec3d        ePolar;
+  APSVec3         eStar;
+  APSVec3         rAst;
   int             CurrentStep;
+  double          MinimaTimes[ MAX_SHADOW_MINIMA ];
+  int             MinimaNumber;
+  int             Runs[ 2 * MAX_SHADOW_RUNS ];
+  int             RunsNumber;
+  double          SearchRadius;
+  double          OutMjdate;
+  double          StartMjdate;
+  double          SmallStep;
   double          s0;
   double          eStarDist;
   double          Delta;
@@ -2291,7 +3003,7 @@ int LOCalc :: ProcessStar1( const LOAsteroid * pLOAsteroid, const LOStar * pLOSt
   double          ExtraRadius;
   double          AngleUncertainty;
   double          TotalUncertainty;
-  const LOEvent * pLOEvent;
+  double          EndOccTime;
   float           Parallax;
   double          ParallaxDelta;
   double          ParallaxAlpha;
@@ -2301,13 +3013,12 @@ int LOCalc :: ProcessStar1( const LOAsteroid * pLOAsteroid, const LOStar * pLOSt
   double          uRAs;
   double          uDE;
   double          VR;
+  int             i;
   int             RetCode = 0;
 
   Mjdate = BeginMjdate;
 
-  ETMjdate = Mjdate + ET_UT / 86400.0;
-
-  CurrentStep = 0;
+  ETMjdate = GetETMjdate( Mjdate );
 
   ExtraRadius = pModule->GetExtraRadius() * apsastroalg::R_Earth; // ExtraRadius must be 3.0 by default
 
@@ -2327,8 +3038,8 @@ int LOCalc :: ProcessStar1( const LOAsteroid * pLOAsteroid, const LOStar * pLOSt
 			   ra, de, plx, uRAs, uDE, VR ) ) {
     std::ostringstream Msg;
     Msg << "ProcessStar1" << std::endl;
-    pModule->InfoMessage( LO_CALC_TRANSFORM_EPOCH, Msg.str() );
-    std::cout << "Error returned by TransformEpoch" << std::endl;
+    InfoMessage( LO_CALC_TRANSFORM_EPOCH, Msg.str() );
+    PrintMessage( "Error returned by TransformEpoch\n" );
     return( 1 );
   }
 
@@ -2344,23 +3055,47 @@ int LOCalc :: ProcessStar1( const LOAsteroid * pLOAsteroid, const LOStar * pLOSt
   double StarRA = apsmathlib::Rad * ra + ParallaxAlpha;
   double StarDec = apsmathlib::Rad * de + ParallaxDelta;
   
-  eStar = APSVec3d( apsmathlib::Polar( StarRA, StarDec ) );
+  ePolar = APSVec3d( apsmathlib::Polar( StarRA, StarDec ) );
 
-  eStar = APSVec3d( eStar[ apsmathlib::x ], eStar[ apsmathlib::y ], eStar[ apsmathlib::z ] / fac );
+  eStar = APSVec3( ePolar[ apsmathlib::x ], ePolar[ apsmathlib::y ], ePolar[ apsmathlib::z ] / fac );
 
   eStarDist = Norm( eStar );
 
   eStar = eStar / eStarDist;
 
-  while( Mjdate < EndMjdate ) {
-    if( CurrentStep >= ScanStep ) {
-      std::cout << "WARNING: ScanStep = " << std::fixed << CurrentStep << " CurrentStep = " << std::fixed << pModule->GetScanStep() << std::endl;
-      break;
+  // MaxDist below grows with the distance and the time, so its bound over the window limits the search
+  TotalUncertainty = std::max( CalculateTotalUncertainty( AngleUncertainty, pLOAsteroid->GetEphemerisUncertainty() * ChebMaxDistance,
+                                                          BeginMjdate, pLOStar->GetMv(), ChebMaxDistance ),
+                               CalculateTotalUncertainty( AngleUncertainty, pLOAsteroid->GetEphemerisUncertainty() * ChebMaxDistance,
+                                                          EndMjdate, pLOStar->GetMv(), ChebMaxDistance ) );
+
+  SearchRadius = std::min( TotalUncertainty + apsastroalg::R_Earth, ExtraRadius );
+
+  // Closest approaches of the shadow axis closer than SearchRadius.
+  // Most stars of the box are rejected by ChebValues and the motion bound,
+  // the series are searched only in steps the bound can't exclude.
+  // As with sampling by Step, two approaches are not expected within one Step.
+  RunsNumber = 0;
+
+  FindShadowRuns( eStar, 0, ScanStep, ScanStep, SearchRadius, Runs, RunsNumber );
+
+  MinimaNumber = 0;
+
+  for( i = 0; i < RunsNumber; i++ ) {
+    MinimaNumber += pShadowMinima->Find( eStar, BeginMjdate, EndMjdate,
+                                         ChebTimes[ Runs[ 2 * i ] ], Runs[ 2 * i + 1 ] < ScanStep ? ChebTimes[ Runs[ 2 * i + 1 ] ] : EndMjdate,
+                                         SearchRadius, Step, MinimaTimes + MinimaNumber, MAX_SHADOW_MINIMA - MinimaNumber );
+  }
+
+  for( i = 0; i < MinimaNumber; i++ ) {
+    // Approach is inside the event created for the previous one
+    if( MinimaTimes[ i ] < Mjdate ) {
+      continue;
     }
 
-    rAstAU = APSVec3d( (*ChebArray[ CurrentStep ])[ apsmathlib::x ], (*ChebArray[ CurrentStep ])[ apsmathlib::y ], (*ChebArray[ CurrentStep ])[ apsmathlib::z ] / fac );
+    Mjdate = MinimaTimes[ i ];
 
-    rAst = GetAU() * rAstAU;
+    rAst = pShadowMinima->GetPosition( Mjdate );
 
     s0 = -Dot( rAst, eStar );
 
@@ -2378,36 +3113,40 @@ int LOCalc :: ProcessStar1( const LOAsteroid * pLOAsteroid, const LOStar * pLOSt
       MaxDist = ExtraRadius;
     } 
 
-    if( r0 < MaxDist ) {
-      pLOEvent = pLOEventData->FindEvent( pLOAsteroid->GetAsteroidID(), pLOStar->GetCatalogue(), pLOStar->GetStarNumber(), Mjdate );
+    if( !( r0 < MaxDist ) ) {
+      continue;
+    }
 
-      if( !pLOEvent ) {
-        Mjdate = Mjdate - Step;
-        CurrentStep--;
+    if( FindStarEvent( pLOAsteroid, pLOStar, pLOEventData, Mjdate, EndOccTime ) ) {
+      Mjdate = EndOccTime;
+      continue;
+    }
 
-        RetCode = CreateOccultationEvent( pLOAsteroid, pLOStar, pLOEventData, eStar, &Mjdate, &CurrentStep, ET_UT, Step, MaxDist );
+    // Last point of ChebValues before the approach which is farther than MaxDist
+    for( CurrentStep = std::min( static_cast<int>( ( Mjdate - BeginMjdate ) / Step ), ScanStep - 1 ); CurrentStep >= 0; CurrentStep-- ) {
+      rAst = GetAU() * APSVec3( ChebValues[ 3 * CurrentStep ], ChebValues[ 3 * CurrentStep + 1 ], ChebValues[ 3 * CurrentStep + 2 ] / fac );
 
-        if( RetCode ) {
-          std::cout << "ERROR: CreateOccultationEvent" << std::endl;
-          break;
-        }
-      }
-      else {
-        CurrentStep = static_cast<int>(( pLOEvent->GetEndOccTime() - BeginMjdate ) / Step ) + 1;
-        Mjdate = BeginMjdate + CurrentStep * Step;
+      s0 = -Dot( rAst, eStar );
 
-        /*printf("======= occultation event has been found in data base. %d %s\n",
-                pLOEvent->GetAsteroidID(), pLOEvent->GetAsteroidNamePtr() );
-        cout << DateTime( pLOEvent->GetBeginOccTime(), HHMMSS ) << endl;
-        cout << DateTime( pLOEvent->GetEndOccTime(), HHMMSS ) << endl;*/
+      if( !( Dot( rAst, rAst ) - s0 * s0 < MaxDist * MaxDist ) ) {
+        break;
       }
     }
 
-    Mjdate = Mjdate + Step;
+    OutMjdate = CurrentStep >= 0 ? ChebTimes[ CurrentStep ] : BeginMjdate - Step;
 
-    ETMjdate = Mjdate + ET_UT / 86400.0;
+    // Fine steps of CreateOccultationEvent pass through the approach, so short grazing events are not lost
+    SmallStep   = Step / SMALL_STEP;
+    StartMjdate = Mjdate - SmallStep * floor( ( Mjdate - OutMjdate ) / SmallStep );
 
-    CurrentStep++;
+    RetCode = CreateOccultationEvent( pLOAsteroid, pLOStar, pLOEventData, eStar, &StartMjdate, &CurrentStep, Step, MaxDist, Mjdate );
+
+    if( RetCode ) {
+      PrintMessage( "ERROR: CreateOccultationEvent\n" );
+      break;
+    }
+
+    Mjdate = StartMjdate;
   }
 
   return( RetCode );  
@@ -2450,7 +3189,7 @@ int LOCalc :: ProcessAsteroid( const LOAsteroid * pLOAsteroid, const LOStarData
                                     ephem, pLOAsteroid->GetObservationEpoch(),
                                     pLOAsteroid->GetM(), pLOAsteroid->GetW(), pLOAsteroid->GetO(),
                                     pLOAsteroid->GetI(), pLOAsteroid->GetE(), pLOAsteroid->GetA(),
-                                    pModule->GetET_UT(), 0.0, 0.0 );
+                                    pModule->GetET_UT(), 0.0, 0.0, pDeltaT );
 
   Step  = 1.0 / pModule->GetScanStep();
 
@@ -2487,86 +3226,476 @@ int LOCalc :: ProcessAsteroid( const LOAsteroid * pLOAsteroid, const LOStarData
   return( RetCode );
 }
 
-int LOCalc :: NewNewNewProcessAsteroid( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData,
-                                        LOEventData * pLOEventData )
+int LOCalc :: FillChebArray( const int ChebOrder, const double * cX, const double * cY, const double * cZ,
+                             const double BeginTime, const double EndTime,
+                             const double BeginMjdate, const double Step, const int ScanStep )
+{
+  apsmathlib::APSChebEval<CHEB_ORDER>     Cheb;
+  apsmathlib::APSChebEval<MAX_CHEB_ORDER> MaxCheb;
+  int                                     CurrentStep;
+  double                                  TmpMjdTime;
+  int                                     RetCode;
+
+  TmpMjdTime = BeginMjdate;
+
+  for( CurrentStep = 0; CurrentStep < ScanStep; CurrentStep++ ) {
+    ChebTimes[ CurrentStep ] = TmpMjdTime;
+
+    TmpMjdTime = TmpMjdTime + Step;
+  }
+
+  if( ChebOrder <= CHEB_ORDER ) {
+    Cheb.Set( ChebOrder, cX, cY, cZ, BeginTime, EndTime );
+
+    RetCode = Cheb.Values( ChebTimes, ScanStep, ChebValues );
+  }
+  else {
+    MaxCheb.Set( ChebOrder, cX, cY, cZ, BeginTime, EndTime );
+
+    RetCode = MaxCheb.Values( ChebTimes, ScanStep, ChebValues );
+  }
+
+  for( CurrentStep = 0; CurrentStep < ScanStep; CurrentStep++ ) {
+    *ChebArray[ CurrentStep ] = APSVec3d( ChebValues[ 3 * CurrentStep ], ChebValues[ 3 * CurrentStep + 1 ], ChebValues[ 3 * CurrentStep + 2 ] );
+  }
+
+  if( pShadowMinima->Set( ChebOrder, cX, cY, cZ, BeginTime, EndTime, GetAU(), fac ) && !RetCode ) {
+    RetCode = 1;
+  }
+
+  // With a margin for rounding of ChebValues against the series of pShadowMinima
+  ChebStepBound = pShadowMinima->GetMotionBound( Step ) * ( 1.0 + 1e-9 ) + 1e-3;
+
+  ChebMaxDistance = 0.0;
+
+  for( CurrentStep = 0; CurrentStep < ScanStep; CurrentStep++ ) {
+    ChebMaxDistance = std::max( ChebMaxDistance, Norm( APSVec3( ChebValues[ 3 * CurrentStep ], ChebValues[ 3 * CurrentStep + 1 ],
+                                                                ChebValues[ 3 * CurrentStep + 2 ] / fac ) ) );
+  }
+
+  ChebMaxDistance = ChebMaxDistance * GetAU() + ChebStepBound;
+
+  return( RetCode );
+}
+
+void LOCalc :: OpenAsteroidScan( LOAsteroidScan & Scan, const LOAsteroid * pLOAsteroid ) const
+{
+  Scan.pLOAsteroid = pLOAsteroid;
+
+  Scan.pLOAstOrbChebMaker = new LOAstOrbChebMaker( pModule->GetChebMakerSubModulePtr(), 
+                                                   ephem, pLOAsteroid->GetObservationEpoch(),
+                                                   pLOAsteroid->GetM(), pLOAsteroid->GetW(), pLOAsteroid->GetO(),
+                                                   pLOAsteroid->GetI(), pLOAsteroid->GetE(), pLOAsteroid->GetA(),
+                                                   pModule->GetET_UT(), 0.0, 0.0, pDeltaT );
+
+  Scan.NextSegmentLength = CHEB_STEP;
+  Scan.SegmentsNumber    = 0;
+  Scan.Segment.Order     = CHEB_ORDER;
+  Scan.Segment.Begin     = MjdStart;
+  Scan.Segment.End       = MjdStart;
+  Scan.Window.Segment    = 0;
+  Scan.Window.Begin      = MjdStart;
+  Scan.Window.Length     = 0.0;
+
+  Scan.IfWindow = NextWindow( Scan );
+}
+
+void LOCalc :: CloseAsteroidScan( LOAsteroidScan & Scan ) const
+{
+  delete Scan.pLOAstOrbChebMaker;
+
+  Scan.pLOAstOrbChebMaker = 0;
+  Scan.IfWindow           = 0;
+}
+
+int LOCalc :: NextSegment( LOAsteroidScan & Scan ) const
+{
+  LOChebSegment & Segment = Scan.Segment;
+  double          SegmentBegin;
+  double          SegmentLength;
+  double          MaxSegmentLength;
+  double          LastMjdTime;
+  double          Tolerance;
+
+  SegmentBegin = Segment.End;
+
+  if( SegmentBegin >= MjdEnd ) {
+    return( 0 );
+  }
+
+  // Tolerance is given in km, approximation is in AU
+  Tolerance = pModule->GetChebTolerance() / GetAU();
+
+  SegmentLength = CHEB_STEP;
+
+  if( Tolerance > 0.0 ) {
+    // End of the last whole day of the interval, segments do not go further
+    LastMjdTime = MjdStart + ceil( ( MjdEnd - MjdStart ) / CHEB_STEP ) * CHEB_STEP;
+
+    MaxSegmentLength = pModule->GetChebMaxSegment();
+
+    if( MaxSegmentLength > LastMjdTime - SegmentBegin ) {
+      MaxSegmentLength = LastMjdTime - SegmentBegin;
+    }
+
+    if( MaxSegmentLength < MIN_CHEB_SEGMENT ) {
+      MaxSegmentLength = MIN_CHEB_SEGMENT;
+    }
+
+    SegmentLength = Scan.NextSegmentLength;
+
+    if( Scan.pLOAstOrbChebMaker->CreateAdaptive( SegmentBegin, MIN_CHEB_SEGMENT, MaxSegmentLength, Tolerance, MAX_CHEB_ORDER,
+                                                 Segment.Order, SegmentLength, Scan.NextSegmentLength,
+                                                 Segment.cX, Segment.cY, Segment.cZ ) ) {
+      std::ostringstream Msg;
+      Msg << Scan.pLOAsteroid->GetAsteroidID() << " " << std::fixed << SegmentBegin << std::endl;
+      pModule->InfoMessage( LO_CALC_CHEB_TOLERANCE, Msg.str() );
+    }
+  }
+  else {
+    Scan.pLOAstOrbChebMaker->Create( CHEB_ORDER, SegmentBegin, SegmentBegin + CHEB_STEP, Segment.cX, Segment.cY, Segment.cZ );
+  }
+
+  Segment.Begin = SegmentBegin;
+  Segment.End   = SegmentBegin + SegmentLength;
+
+  Scan.Window.Segment = Scan.SegmentsNumber++;
+
+  return( 1 );
+}
+
+int LOCalc :: NextWindow( LOAsteroidScan & Scan ) const
+{
+  LOScanWindow & Window = Scan.Window;
+
+  Window.Begin += Window.Length;
+
+  if( !( Window.Begin < MjdEnd ) || !( Scan.Segment.End - Window.Begin > WINDOW_EPS ) ) {
+    if( !NextSegment( Scan ) ) {
+      return( 0 );
+    }
+
+    Window.Begin = Scan.Segment.Begin;
+  }
+
+  Window.Length = Scan.Segment.End - Window.Begin;
+
+  if( Window.Length > CHEB_STEP - WINDOW_EPS ) {
+    Window.Length = CHEB_STEP;
+  }
+
+  return( 1 );
+}
+
+void LOCalc :: CreateWindows( const LOAsteroid * pLOAsteroid,
+                              std::vector<LOChebSegment> & Segments, std::vector<LOScanWindow> & Windows ) const
+{
+  LOAsteroidScan Scan;
+
+  for( OpenAsteroidScan( Scan, pLOAsteroid ); Scan.IfWindow; Scan.IfWindow = NextWindow( Scan ) ) {
+    if( Scan.Window.Segment == Segments.size() ) {
+      Segments.push_back( Scan.Segment );
+    }
+
+    Windows.push_back( Scan.Window );
+  }
+
+  CloseAsteroidScan( Scan );
+}
+
+int LOCalc :: ProcessWindow( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData, LOEventData * pLOEventData,
+                             const LOChebSegment & Segment, const LOScanWindow & Window )
 {
   unsigned int          i;
-  LOAstOrbChebMaker   * pLOAstOrbChebMaker;
-  apsmathlib::APSCheb * pAPSCheb;
   double                Step;
   int                   ScanStep;
-  int                   CurrentStep;
-  double                TmpMjdTime;
-  double                CurrentMjdTime;
   const LOStar        * pLOStar;
-  APSVec3d              r_equ;
-  double                ET_UT;
-  bool                  valid;
-  double                cX[ CHEB_ORDER + 1 ];
-  double                cY[ CHEB_ORDER + 1 ];
-  double                cZ[ CHEB_ORDER + 1 ];
   int                   RetCode = 0;
 
   ScanStep = pModule->GetScanStep();
 
-  Step  = CHEB_STEP / ScanStep;
+  Step = Window.Length / ScanStep;
+
+  if( FillChebArray( Segment.Order, Segment.cX, Segment.cY, Segment.cZ, Segment.Begin, Segment.End, Window.Begin, Step, ScanStep ) ) {
+    PrintMessage( "ERROR: FillChebArray\n" );
+    RetCode = 1000;
+  }
+
+  if( IfElongationCulled( Window.Begin, Step, ScanStep ) ) {
+    ElongationCulledDays += Window.Length;
+    return( RetCode );
+  }
+
+  //cout << DateTime( Window.Begin, HHh );
+  ScanStars2( pLOStarData, ScanStep, GetStarMaxMv( pLOAsteroid, Window.Begin, Window.Begin + Window.Length - Step, ScanStep ) );
+  //printf(" Stars number: %d\n", GetStarsCount() );
+
+  for( i = 0; i < GetStarsCount(); i++ ) {
+    pLOStar = GetStar( i );
+
+    if( ProcessStar1( pLOAsteroid, pLOStar, pLOEventData, Window.Begin, Window.Begin + Window.Length, Step, ScanStep ) ) {
+      // We continue to process next star
+      // Warning...
+      //pModule->ErrorMessage( LO_CALC_STAR_PROCESSING );    
+      //RetCode = LO_CALC_STAR_PROCESSING;
+      //break;
+    }
+  }
+
+  return( RetCode );
+}
+
+void LOCalc :: ProcessTimeChunk( LOTimeChunk * pChunk )
+{
+  LOCalc       * pLOCalc = pChunk->pLOCalc;
+  unsigned int   SiteRejectedEvents = pLOCalc->SiteRejectedEvents;
+  double         ElongationCulledDays = pLOCalc->ElongationCulledDays;
+  unsigned int   i;
+
+  pLOCalc->pChunkEvents   = &pChunk->Events;
+  pLOCalc->pChunkMessages = &pChunk->Messages;
+
+  for( i = pChunk->ScanWindow; i < pChunk->LastWindow; i++ ) {
+    const LOScanWindow & Window = ( *pChunk->pWindows )[ i ];
+
+    if( i == pChunk->FirstWindow ) { // Overlap belongs to the previous chunk, its messages and counters are dropped
+      pChunk->Messages.clear();
+
+      pLOCalc->SiteRejectedEvents   = SiteRejectedEvents;
+      pLOCalc->ElongationCulledDays = ElongationCulledDays;
+    }
+
+    if( pLOCalc->ProcessWindow( pChunk->pLOAsteroid, pChunk->pLOStarData, 0,
+                                ( *pChunk->pSegments )[ Window.Segment ], Window ) ) {
+      if( i >= pChunk->FirstWindow ) {
+        pChunk->RetCode = 1000;
+      }
+    }
+  }
+
+  pLOCalc->pChunkEvents   = 0;
+  pLOCalc->pChunkMessages = 0;
+}
+
+void * LOCalc :: ProcessTimeChunkThread( void * pArg )
+{
+  ProcessTimeChunk( static_cast<LOTimeChunk *>( pArg ) );
+
+  return( 0 );
+}
+
+int LOCalc :: ProcessTimeChunks( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData, LOEventData * pLOEventData,
+                                 const std::vector<LOChebSegment> & Segments, const std::vector<LOScanWindow> & Windows )
+{
+  std::vector<LOTimeChunk> Chunks;
+  const LOChunkEvent     * pChunkEvent;
+  const LOChunkMessage   * pChunkMessage;
+  LOCalc                 * pLOCalc;
+  unsigned int             ScanWindow;
+  int                      ChunksNumber;
+  int                      i;
+  unsigned int             j;
+  int                      RetCode = 0;
+
+  ChunksNumber = static_cast<int>( Windows.size() / MIN_CHUNK_WINDOWS );
+
+  if( ChunksNumber > WorkersNumber + 1 ) {
+    ChunksNumber = WorkersNumber + 1;
+  }
+
+  if( ChunksNumber < 1 ) {
+    ChunksNumber = 1;
+  }
+
+  Chunks.resize( ChunksNumber );
+
+  std::vector<pthread_t> Threads( ChunksNumber );
+  std::vector<bool>      IfThreads( ChunksNumber, false );
+
+  for( i = 0; i < ChunksNumber; i++ ) {
+    Chunks[ i ].pLOCalc     = i ? pWorkers[ i - 1 ] : this;
+    Chunks[ i ].pLOAsteroid = pLOAsteroid;
+    Chunks[ i ].pLOStarData = pLOStarData;
+    Chunks[ i ].pSegments   = &Segments;
+    Chunks[ i ].pWindows    = &Windows;
+    Chunks[ i ].FirstWindow = Windows.size() * i / ChunksNumber;
+    Chunks[ i ].LastWindow  = Windows.size() * ( i + 1 ) / ChunksNumber;
+    Chunks[ i ].BeginMjdate = Windows[ Chunks[ i ].FirstWindow ].Begin;
+    Chunks[ i ].EndMjdate   = std::numeric_limits<double>::max();
+    Chunks[ i ].RetCode     = 0;
+
+    // Events crossing the chunk begin are found as without chunks
+    ScanWindow = Chunks[ i ].FirstWindow;
+
+    while( ( ScanWindow > 0 ) &&
+           ( Windows[ ScanWindow - 1 ].Begin + Windows[ ScanWindow - 1 ].Length > Chunks[ i ].BeginMjdate - CHUNK_OVERLAP ) ) {
+      ScanWindow--;
+    }
+
+    Chunks[ i ].ScanWindow = ScanWindow;
+
+    if( i ) {
+      Chunks[ i - 1 ].EndMjdate = Chunks[ i ].BeginMjdate;
+    }
+  }
+
+  for( i = 1; i < ChunksNumber; i++ ) {
+    if( !pthread_create( &Threads[ i ], 0, ProcessTimeChunkThread, &Chunks[ i ] ) ) {
+      IfThreads[ i ] = true;
+    }
+    else {
+      pModule->WarningMessage( LO_CALC_THREAD );
+    }
+  }
+
+  for( i = 0; i < ChunksNumber; i++ ) {
+    if( IfThreads[ i ] ) {
+      pthread_join( Threads[ i ], 0 );
+    }
+    else {
+      ProcessTimeChunk( &Chunks[ i ] );
+    }
+  }
+
+  // Saving order is the same as without chunks. An event found by two chunks is saved by
+  // the one whose interval has its approach.
+  for( i = 0; i < ChunksNumber; i++ ) {
+    for( j = 0; j < Chunks[ i ].Messages.size(); j++ ) {
+      pChunkMessage = &Chunks[ i ].Messages[ j ];
+
+      if( pChunkMessage->Code ) {
+        pModule->InfoMessage( pChunkMessage->Code, pChunkMessage->Text );
+      }
+      else {
+        std::cout << pChunkMessage->Text;
+      }
+    }
+
+    for( j = 0; j < Chunks[ i ].Events.size(); j++ ) {
+      pChunkEvent = &Chunks[ i ].Events[ j ];
+
+      if( ( pChunkEvent->ApproachMjdate < Chunks[ i ].BeginMjdate ) ||
+          ( pChunkEvent->ApproachMjdate >= Chunks[ i ].EndMjdate ) ) {
+        continue;
+      }
+
+      if( SaveOccultationEvent( pLOAsteroid, pChunkEvent->pLOStar, pLOEventData,
+                                pChunkEvent->BeginOccTime, pChunkEvent->EndOccTime,
+                                pChunkEvent->EarthFlag, pChunkEvent->MaxDuration ) ) {
+        std::cout << "ERROR: SaveOccultationEvent" << std::endl;
+      }
+    }
+
+    if( Chunks[ i ].RetCode ) {
+      RetCode = Chunks[ i ].RetCode;
+    }
+
+    if( i ) {
+      pLOCalc = pWorkers[ i - 1 ];
+
+      SiteRejectedEvents   += pLOCalc->SiteRejectedEvents;
+      ElongationCulledDays += pLOCalc->ElongationCulledDays;
+
+      pLOCalc->SiteRejectedEvents   = 0;
+      pLOCalc->ElongationCulledDays = 0.0;
+    }
+  }
+
+  return( RetCode );
+}
+
+int LOCalc :: NewNewNewProcessAsteroid( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData,
+                                        LOEventData * pLOEventData )
+{
+  std::vector<LOChebSegment> Segments;
+  std::vector<LOScanWindow>  Windows;
+  unsigned int               i;
+  int                        RetCode = 0;
 
   std::ostringstream Msg;
   Msg << pLOAsteroid->GetAsteroidID() << " " << pLOAsteroid->GetAsteroidNamePtr() << std::endl;
 
   pModule->InfoMessage( LO_CALC_START_ASTEROID_PROCESSING, Msg.str() );
 
-  apsastroalg::ETminUT( ( MjdStart - apsastroalg::MJD_J2000 ) / 36525.0, ET_UT, valid );
+  CreateWindows( pLOAsteroid, Segments, Windows );
 
-  if( !valid ) {
-    ET_UT = pModule->GetET_UT();
+  if( WorkersNumber && ( Windows.size() >= 2 * MIN_CHUNK_WINDOWS ) ) {
+    RetCode = ProcessTimeChunks( pLOAsteroid, pLOStarData, pLOEventData, Segments, Windows );
+  }
+  else {
+    for( i = 0; i < Windows.size(); i++ ) {
+      if( ProcessWindow( pLOAsteroid, pLOStarData, pLOEventData, Segments[ Windows[ i ].Segment ], Windows[ i ] ) ) {
+        RetCode = 1000;
+      }
+    }
   }
 
-  pLOAstOrbChebMaker = new LOAstOrbChebMaker( pModule->GetChebMakerSubModulePtr(), 
-                                              ephem, pLOAsteroid->GetObservationEpoch(),
-                                              pLOAsteroid->GetM(), pLOAsteroid->GetW(), pLOAsteroid->GetO(),
-                                              pLOAsteroid->GetI(), pLOAsteroid->GetE(), pLOAsteroid->GetA(),
-                                              ET_UT, 0.0, 0.0);
+  return( RetCode );
+}
 
-  for( CurrentMjdTime = MjdStart; CurrentMjdTime < MjdEnd; CurrentMjdTime += CHEB_STEP ) {
-    pLOAstOrbChebMaker->Create( CHEB_ORDER, CurrentMjdTime, CurrentMjdTime + CHEB_STEP, cX, cY, cZ );
+int LOCalc :: ProcessAsteroidsByDays( const LOAstOrbData * pLOAstOrbData, const LOStarData * pLOStarData,
+                                      LOEventData * pLOEventData, const unsigned int FirstAsteroid )
+{
+  std::vector<LOAsteroidScan> Scans;
+  const LOAsteroid          * pLOAsteroid;
+  unsigned int                BlockSize;
+  unsigned int                i;
+  unsigned int                j;
+  double                      DayEnd;
+  int                         RetCode = 0;
 
-    pAPSCheb = new apsmathlib::APSCheb( pModule->GetChebSubModulePtr(), CHEB_ORDER, cX, cY, cZ, CurrentMjdTime, CurrentMjdTime + CHEB_STEP );
+  BlockSize = static_cast<unsigned int>( pModule->GetDayMajorBlock() );
 
-    TmpMjdTime = CurrentMjdTime;
+  Scans.reserve( BlockSize );
 
-    for( CurrentStep = 0; CurrentStep < ScanStep; CurrentStep++ ) {
-      if( pAPSCheb->Value( TmpMjdTime, r_equ ) ) {
-        std::cout << "ERROR: pAPSCheb->Value1" << std::endl;
-        RetCode = 1000;
-        break;
-      }
+  for( i = FirstAsteroid; ( i < pLOAstOrbData->GetCurrentNumber() ) && !RetCode; ) {
+    // Next block of asteroids, their integrators stay open until the end of the interval
+    for( ; ( i < pLOAstOrbData->GetCurrentNumber() ) && ( Scans.size() < BlockSize ); i++ ) {
+      pLOAsteroid = pLOAstOrbData->GetAsteroidPtr( i );
+
+      if( IfAsteroid( pLOAsteroid ) ) {
+        std::ostringstream Msg;
+        Msg << pLOAsteroid->GetAsteroidID() << " " << pLOAsteroid->GetAsteroidNamePtr() << std::endl;
 
-      *ChebArray[ CurrentStep ] = r_equ;
+        pModule->InfoMessage( LO_CALC_START_ASTEROID_PROCESSING, Msg.str() );
 
-      TmpMjdTime = TmpMjdTime + Step;
+        Scans.push_back( LOAsteroidScan() );
+
+        OpenAsteroidScan( Scans.back(), pLOAsteroid );
+      }
     }
 
-    delete pAPSCheb;
+    {
+      std::ostringstream Msg;
+      Msg << Scans.size() << std::endl;
+      pModule->InfoMessage( LO_CALC_DAY_MAJOR_BLOCK, Msg.str() );
+    }
 
-    //cout << DateTime( CurrentMjdTime, HHh );
-    ScanStars2( pLOStarData, ScanStep );
-    //printf(" Stars number: %d\n", GetStarsCount() );
+    // Star regions, precession and body tables of one day are used by all asteroids of the block
+    for( DayEnd = MjdStart + CHEB_STEP; ( DayEnd - CHEB_STEP < MjdEnd ) && !RetCode; DayEnd += CHEB_STEP ) {
+      for( j = 0; j < Scans.size(); j++ ) {
+        LOAsteroidScan & Scan = Scans[ j ];
 
-    for( i = 0; i < GetStarsCount(); i++ ) {
-      pLOStar = GetStar( i );
+        while( Scan.IfWindow && ( Scan.Window.Begin < DayEnd - WINDOW_EPS ) ) {
+          if( ProcessWindow( Scan.pLOAsteroid, pLOStarData, pLOEventData, Scan.Segment, Scan.Window ) ) {
+            RetCode = 1000;
+          }
 
-      if( ProcessStar1( pLOAsteroid, pLOStar, pLOEventData, CurrentMjdTime, CurrentMjdTime + CHEB_STEP, ET_UT, Step, ScanStep ) ) {
-        // We continue to process next star
-        // Warning...
-        //pModule->ErrorMessage( LO_CALC_STAR_PROCESSING );    
-        //RetCode = LO_CALC_STAR_PROCESSING;
-        //break;
+          Scan.IfWindow = NextWindow( Scan );
+        }
       }
-    }     
-  }
+    }
 
-  delete pLOAstOrbChebMaker;
+    for( j = 0; j < Scans.size(); j++ ) {
+      CloseAsteroidScan( Scans[ j ] );
+    }
+
+    Scans.clear();
+
+    if( !RetCode ) {
+      SaveCheckpoint( pLOAstOrbData, pLOEventData, i, false );
+    }
+  }
 
   return( RetCode );
 }
@@ -2588,10 +3717,72 @@ int LOCalc :: IfAsteroid( const LOAsteroid * pLOAsteroid ) const
   return( 0 );
 }
 
+int LOCalc :: StartResume( const LOAstOrbData * pLOAstOrbData, unsigned int & FirstAsteroid )
+{
+  FirstAsteroid = 0;
+
+  if( !pResumeCheckpoint ) {
+    return( 0 );
+  }
+
+  // Astorb data must be the same as in the run which wrote the checkpoint
+  if( ( pResumeCheckpoint->AsteroidIndex < 0 ) ||
+      ( static_cast<unsigned int>( pResumeCheckpoint->AsteroidIndex ) > pLOAstOrbData->GetCurrentNumber() ) ) {
+    pModule->ErrorMessage( LO_CALC_CHECKPOINT );
+    return( LO_CALC_CHECKPOINT );
+  }
+
+  FirstAsteroid = pResumeCheckpoint->AsteroidIndex;
+
+  if( FirstAsteroid && ( pLOAstOrbData->GetAsteroidPtr( FirstAsteroid - 1 )->GetAsteroidID() != pResumeCheckpoint->AsteroidID ) ) {
+    pModule->ErrorMessage( LO_CALC_CHECKPOINT );
+    return( LO_CALC_CHECKPOINT );
+  }
+
+  SiteRejectedEvents   = pResumeCheckpoint->SiteRejectedEvents;
+  ElongationCulledDays = pResumeCheckpoint->ElongationCulledDays;
+
+  std::ostringstream Msg;
+  Msg << pResumeCheckpoint->AsteroidID << std::endl;
+  pModule->InfoMessage( LO_CALC_RESUME, Msg.str() );
+
+  return( 0 );
+}
+
+void LOCalc :: SaveCheckpoint( const LOAstOrbData * pLOAstOrbData, LOEventData * pLOEventData,
+                               const unsigned int NextAsteroid, const bool IfForce )
+{
+  LOCheckpoint Checkpoint;
+
+  if( !pLOEventData->GetEventSinkPtr() ) {
+    return;
+  }
+
+  if( !IfForce && ( time( 0 ) - CheckpointTime < CHECKPOINT_PERIOD ) ) {
+    return;
+  }
+
+  Checkpoint.AsteroidIndex = NextAsteroid;
+  Checkpoint.AsteroidID    = NextAsteroid ? pLOAstOrbData->GetAsteroidPtr( NextAsteroid - 1 )->GetAsteroidID() : 0;
+#ifdef WITH_MYSQL
+  Checkpoint.SQLNumber     = mysql_count;
+#else
+  Checkpoint.SQLNumber     = 0;
+#endif
+
+  Checkpoint.SiteRejectedEvents   = SiteRejectedEvents;
+  Checkpoint.ElongationCulledDays = ElongationCulledDays;
+
+  pLOEventData->GetEventSinkPtr()->Checkpoint( Checkpoint );
+
+  CheckpointTime = time( 0 );
+}
+
 int LOCalc :: ProcessManyAsteroids( const LOAstOrbData * pLOAstOrbData, const LOStarData * pLOStarData,
                                     LOEventData * pLOEventData )
 {
   unsigned int       i;
+  unsigned int       FirstAsteroid;
   int                TotalAsteroids;
   const LOAsteroid * pLOAsteroid;
   int                RetCode = 0;
@@ -2608,19 +3799,38 @@ int LOCalc :: ProcessManyAsteroids( const LOAstOrbData * pLOAstOrbData, const LO
 
   std::cout << "TotalAsteroids = " << TotalAsteroids << std::endl;
 
-  for( i = 0; i < pLOAstOrbData->GetCurrentNumber(); i++ ) {
-    pLOAsteroid = pLOAstOrbData->GetAsteroidPtr( i );
+  RetCode = StartResume( pLOAstOrbData, FirstAsteroid );
 
-    if( IfAsteroid( pLOAsteroid ) ) {
-      //RetCode = ProcessAsteroid( pLOAsteroid, pLOStarData );
-      RetCode = NewNewNewProcessAsteroid( pLOAsteroid, pLOStarData, pLOEventData );
+  if( RetCode ) {
+    return( RetCode );
+  }
 
-      if( RetCode ) {
-        break;
+  CheckpointTime = time( 0 );
+
+  if( pModule->GetDayMajorBlock() > 0 ) {
+    RetCode = ProcessAsteroidsByDays( pLOAstOrbData, pLOStarData, pLOEventData, FirstAsteroid );
+  }
+  else {
+    for( i = FirstAsteroid; i < pLOAstOrbData->GetCurrentNumber(); i++ ) {
+      pLOAsteroid = pLOAstOrbData->GetAsteroidPtr( i );
+
+      if( IfAsteroid( pLOAsteroid ) ) {
+        //RetCode = ProcessAsteroid( pLOAsteroid, pLOStarData );
+        RetCode = NewNewNewProcessAsteroid( pLOAsteroid, pLOStarData, pLOEventData );
+
+        if( RetCode ) {
+          break;
+        }
+
+        SaveCheckpoint( pLOAstOrbData, pLOEventData, i + 1, false );
       }
     }
   }
 
+  if( !RetCode ) {
+    SaveCheckpoint( pLOAstOrbData, pLOEventData, pLOAstOrbData->GetCurrentNumber(), true );
+  }
+
   return( RetCode );
 }
 
@@ -2644,9 +3854,19 @@ int LOCalc :: Run( LOData * pLOData )
 
   AU = ephem->GetAU();
 
+  if( CreateDeltaT() ) {
+    return( LO_CALC_ET_UT );
+  }
+
   MjdStart = apsastroalg::Mjd( pModule->GetStartYear(), pModule->GetStartMonth(), pModule->GetStartDay() );
   MjdEnd   = apsastroalg::Mjd( pModule->GetEndYear(), pModule->GetEndMonth(), pModule->GetEndDay() ) + 1.0;
 
+  CreatePrecNutTable( MjdStart, MjdEnd );
+
+  CreateBodyEph( MjdStart, MjdEnd );
+
+  CreateSiteLimits( pLOData->GetPosDataPtr() );
+
   pLOAstOrbData = pLOData->GetAstOrbDataPtr();
 
   pLOStarData = pLOData->GetStarDataPtr();
@@ -2674,16 +3894,22 @@ int LOCalc :: Run( LOData * pLOData )
         exit( 1 );
       }
 
-      mysql_count = pModule->GetStartSQLNumber();
+      mysql_count = pResumeCheckpoint ? pResumeCheckpoint->SQLNumber : pModule->GetStartSQLNumber();
     }
 #endif
 
     pModule->InfoMessage( LO_CALC_START_KDTREE );
 
-    if( !pLOData->BuildKDTree() ) {
+    if( !pLOData->BuildKDTree( pModule->GetKDTreeThreadsNumber() ) ) {
       pModule->InfoMessage( LO_CALC_FINISH_KDTREE );
 
-      RetCode = ProcessManyAsteroids( pLOAstOrbData, pLOStarData, pLOEventData );
+      RetCode = CreateWorkers();
+
+      if( !RetCode ) {
+        RetCode = ProcessManyAsteroids( pLOAstOrbData, pLOStarData, pLOEventData );
+      }
+
+      DeleteWorkers();
 
       pLOEventData->Rebuild();
     }
@@ -2704,8 +3930,22 @@ int LOCalc :: Run( LOData * pLOData )
     RetCode = LO_CALC_ASTEROID_ERROR;
   }
 
+  if( IfSiteLimits ) {
+    std::ostringstream Msg;
+    Msg << SiteRejectedEvents << std::endl;
+    pModule->InfoMessage( LO_CALC_SITE_REJECTED, Msg.str() );
+  }
+
+  if( ( pModule->GetMinSunElongation() > 0.0 ) || ( pModule->GetMinMoonElongation() > 0.0 ) ) {
+    std::ostringstream Msg;
+    Msg << std::fixed << std::setprecision( 1 ) << ElongationCulledDays << std::endl;
+    pModule->InfoMessage( LO_CALC_ELONGATION_CULLED, Msg.str() );
+  }
+
   pModule->InfoMessage( LO_CALC_FINISH );
 
+  DeleteBodyEph();
+
   delete ephem;
 
   ephem = 0;
@@ -2716,7 +3956,7 @@ int LOCalc :: Run( LOData * pLOData )
 int LOCalc :: ProcessOnePosition( LOPos * pLOPos, LOEventData * pLOEventData, LOPointEventData * pLOPointEventData ) const
 {
   unsigned int   i;
-  LOEvent      * pLOEvent;
+  const LOEvent * pLOEvent;
   const LOPointEvent * pLOPointEvent;
   double         Diameter;
   //double         ObservationEpoch;
@@ -2863,7 +4103,7 @@ int LOCalc :: ReRun( LOData * pLOData )
 {
   unsigned int          i;
   LOEventData         * pLOEventData;
-  LOEvent             * pLOEvent;
+  const LOEvent       * pLOEvent;
   LOPosData           * pLOPosData;
   LOPointEventData    * pLOPointEventData;
   LOPos               * pLOPos;
@@ -2880,6 +4120,10 @@ int LOCalc :: ReRun( LOData * pLOData )
 
   AU = ephem->GetAU();
 
+  if( CreateDeltaT() ) {
+    return( LO_CALC_ET_UT );
+  }
+
   pLOEventData = pLOData->GetEventDataPtr();
 
   /* must be in positions reader */
@@ -2893,6 +4137,27 @@ int LOCalc :: ReRun( LOData * pLOData )
 
   pLOPosData->Rebuild();
 
+  if( pLOEventData->GetEventsNumber() > 0 ) {
+    double BeginMjd = pLOEventData->GetEventPtr( 0 )->GetBeginOccTime();
+    double EndMjd   = pLOEventData->GetEventPtr( 0 )->GetEndOccTime();
+
+    for( i = 1; i < pLOEventData->GetEventsNumber(); i++ ) {
+      pLOEvent = pLOEventData->GetEventPtr( i );
+
+      if( pLOEvent->GetBeginOccTime() < BeginMjd ) {
+        BeginMjd = pLOEvent->GetBeginOccTime();
+      }
+
+      if( pLOEvent->GetEndOccTime() > EndMjd ) {
+        EndMjd = pLOEvent->GetEndOccTime();
+      }
+    }
+
+    CreatePrecNutTable( BeginMjd, EndMjd );
+
+    CreateBodyEph( BeginMjd, EndMjd );
+  }
+
   for( i = 0; i < pLOPosData->GetPositionsNumber(); i++ ) {
     pLOPos = pLOPosData->GetPositionPtr( i );
 
@@ -2918,6 +4183,8 @@ int LOCalc :: ReRun( LOData * pLOData )
     }
   }
 
+  DeleteBodyEph();
+
   delete ephem;
 
   ephem = 0;
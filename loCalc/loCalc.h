@@ -12,6 +12,23 @@
 //         version 0.3 07.02.2005 Event data was added
 //         version 0.4 15.02.2005 CalculateBrightness was added
 //         version 0.5  9.02.2021 MAX_STAR_NUMBER 100000 -> 1000000
+//         version 0.6 19.10.2026 APSChebEval is used instead of APSCheb
+//         version 0.7 19.10.2026 Adaptive Chebyshev segments
+//         version 0.8 19.10.2026 Precession-nutation table
+//         version 0.9 19.10.2026 Table-driven ET-UT was added
+//         version 0.10 19.10.2026 Sun, Moon and Earth positions from APSBodyEph
+//         version 0.11 19.10.2026 APSVec3, APSMat3 in inner loops
+//         version 0.12 19.10.2026 SiteConstraints was added
+//         version 0.13 19.10.2026 Star magnitude limit from minimal drop
+//         version 0.14 19.10.2026 Sun and Moon elongation culling
+//         version 0.15 19.10.2026 Bisection with asteroid motion bound in ProcessStar1
+//         version 0.16 19.10.2026 Closest approaches from Chebyshev series, LOShadowMinima
+//         version 0.17 19.10.2026 Time chunks of one asteroid processed by threads
+//         version 0.18 19.10.2026 Day-major order, LOAsteroidScan
+//         version 0.19 19.10.2026 Checkpoints and resume
+//         version 0.20 19.10.2026 Search radius from the MaxDist bound of the window
+//         version 0.21 19.10.2026 Chunk messages emitted by the calling thread, overlapped chunks
+//         version 0.22 19.10.2026 ET-UT at each conversion time, TaiUtc file
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -33,21 +50,38 @@
 #define LO_CALC_H
 
 #include <string>
+#include <vector>
+#include <ctime>
 
 namespace aps {
 
   namespace apsmathlib {
     class APSVec3d;
+    class APSMat3d;
+    struct APSVec3;
+    struct APSMat3;
   }
 
   namespace apsastrodata {
     class APSJPLEph;
+    class APSBodyEph;
+  }
+
+  namespace apsastroalg {
+    class APSPrecNutTable;
+    class APSDeltaT;
   }
 
   namespace apslinoccult {
 
 using apsmathlib::APSVec3d;
+using apsmathlib::APSMat3d;
+using apsmathlib::APSVec3;
+using apsmathlib::APSMat3;
 using apsastrodata::APSJPLEph;
+using apsastrodata::APSBodyEph;
+using apsastroalg::APSPrecNutTable;
+using apsastroalg::APSDeltaT;
 
 class LOData;
 class LOModuleCalc;
@@ -59,6 +93,15 @@ class LOPointEventData;
 class LOAstOrbData;
 class LOStar;
 class LOPos;
+class LOPosData;
+class LOShadowMinima;
+struct LOChebSegment;
+struct LOScanWindow;
+struct LOChunkEvent;
+struct LOChunkMessage;
+struct LOTimeChunk;
+struct LOAsteroidScan;
+struct LOCheckpoint;
 
 const unsigned int MAX_STAR_NUMBER = 1000000; // For near Earth asteroids this limit should be increased
 
@@ -69,18 +112,85 @@ class LOCalc
   private:
 
     LOModuleCalc  * pModule;
-    APSJPLEph     * ephem;
+    const LOCalc  * pParent;        // Main calculation of a time chunk worker, 0 for the main one
+    APSJPLEph     * ephem;          // Own for each worker, APSJPLEph can't be shared by threads
     double          MjdStart;
     double          MjdEnd;
     const LOStar  * pLOStarsArray[ MAX_STAR_NUMBER ];
     unsigned int    StarsCount;
     int             EventStar;
     APSVec3d     ** ChebArray;
+    double        * ChebTimes;
+    double        * ChebValues;
+    double          ChebStepBound;  // km, bound of the asteroid motion in one Step of ChebValues
+    double          ChebMaxDistance; // km, bound of the asteroid distance in the window of ChebValues
+    LOShadowMinima * pShadowMinima; // Series of the window filled by FillChebArray
+    APSPrecNutTable * pPrecNutTable;
+    APSBodyEph    * pBodyEph;
+
+    // Union of sites constraints, see CreateSiteLimits
+    int             IfSiteLimits;
+    short           SiteMaxMv;          // 0.01 mag
+    double          SiteMinDuration;    // Seconds
+    double          SiteMinDrop;        // Mag
+    double          SiteMaxSunElev;     // Degrees
+    double          SiteMaxDistance;    // km
+    mutable unsigned int SiteRejectedEvents;
+    mutable double  ElongationCulledDays;
+    APSDeltaT     * pDeltaT;
     double          AU;
 
+    // Time chunks of one asteroid, see ProcessTimeChunks
+    LOCalc       ** pWorkers;       // Workers of chunks 1, 2, ..., chunk 0 is processed by the main calculation
+    int             WorkersNumber;
+    std::vector<LOChunkEvent> * pChunkEvents; // Events of the chunk being processed, 0 if events are saved at once
+    std::vector<LOChunkMessage> * pChunkMessages; // Messages of the chunk being processed, 0 if they are emitted at once
+
+    const LOCheckpoint * pResumeCheckpoint; // Asteroids before it are not processed, 0 for a new run
+    time_t          CheckpointTime;
+
+    // Worker of time chunks sharing tables of the main calculation
+    LOCalc( const LOCalc * apParent );
+
+    int CreateWorkers( void );
+
+    void DeleteWorkers( void );
+
     double GetAU( void ) const
       { return( AU ); }
 
+    // Precession and nutation from J2000 to date, Mjd is the time used for T
+    APSMat3d GetEquToTrueMatrix( const double Mjd ) const;
+
+    double GetEquEqu( const double Mjd ) const;
+
+    void CreatePrecNutTable( const double BeginMjd, const double EndMjd );
+
+    // ET - UT in seconds
+    double GetETminUT( const double Mjd ) const;
+
+    // ET of UT Mjd
+    double GetETMjdate( const double Mjd ) const
+      { return( Mjd + GetETminUT( Mjd ) / 86400.0 ); }
+
+    int CreateDeltaT( void );
+
+    // In AU, from pBodyEph if it exists
+    APSVec3d SunEquPos( const double Mjd ) const;
+    APSVec3d MoonEquPos( const double Mjd ) const;
+    APSVec3d EarthBaryEquPos( const double Mjd ) const;
+
+    void CreateBodyEph( const double BeginMjd, const double EndMjd );
+
+    void DeleteBodyEph( void );
+
+    void CreateSiteLimits( LOPosData * pLOPosData );
+
+    // Returns 0 if no site can accept the event
+    int IfSiteAccepted( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar,
+                        const APSVec3d & rAstAU, const double ETMjdate,
+                        const int EarthFlag, const double MaxDuration, const double MinTrackSunElev ) const;
+
     int AddStar( const LOStar * pStar );
 
     const LOStar * GetStar( const unsigned int StarNumber ) const;
@@ -101,11 +211,24 @@ class LOCalc
 
     void ScanStars1( const LOStarData * pLOStarData, APSVec3d * r_Asteroid1, APSVec3d * r_Asteroid2 );
 
-    int ScanStars2( const LOStarData * pLOStarData, const int ScanStep );
+    /* Stars fainter than MaxMv (in 0.01 mag) are skipped */
+    int ScanStars2( const LOStarData * pLOStarData, const int ScanStep, const short MaxMv );
+
+    /* True if Sun or Moon elongation of the asteroid is below its limit over the whole ChebValues
+       window, so no event of the window can be observed */
+    bool IfElongationCulled( const double BeginMjdate, const double Step, const int ScanStep ) const;
+
+    /* Faintest star (in 0.01 mag) giving CalcMinDrop with the asteroid between the first
+       and the last point of ChebValues */
+    short GetStarMaxMv( const LOAsteroid * pLOAsteroid, const double BeginMjdate, const double EndMjdate,
+                        const int ScanStep ) const;
 
     double CalculateBrightness( const LOAsteroid * pLOAsteroid, const APSVec3d & R_Sun,
                                 const APSVec3d & rAstAU ) const;
 
+    // Magnitude drop of star with Mv in 0.01 mag occulted by asteroid of Brightness mag
+    static double CalculateBrightDelta( const short Mv, const double Brightness );
+
     void CalcParallax( const LOStar * pLOStar, const double ETMjdate, const float Parallax,
                        double & ParallaxDelta, double & ParallaxAlpha ) const;
 
@@ -187,19 +310,41 @@ class LOCalc
     int SaveOccultationEvent( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar,
                               LOEventData * pLOEventData,
                               const double BeginOccTime, const double EndOccTime,
-                              const int EarthFlag, const double MaxDuration, const double ET_UT ) const;
+                              const int EarthFlag, const double MaxDuration ) const;
 
     double CalcDuration( const APSVec3d & eStar, const double Diameter, const APSVec3d & r,
                          const APSVec3d & r_prev, const double SmallStep ) const;
 
+    double CalcDuration( const APSVec3 & eStar, const double Diameter, const APSVec3 & r,
+                         const APSVec3 & r_prev, const double SmallStep ) const;
+
     int CreateOccultationEvent( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar,
                                 LOEventData * pLOEventData,
-                                const APSVec3d & eStar, double * StartMjdate, int * StartStep,
-                                const double ET_UT, const double Step, const double MaxDist ) const;
+                                const APSVec3 & eStar, double * StartMjdate, int * StartStep,
+                                const double Step, const double MaxDist,
+                                const double ApproachMjdate ) const;
+
+    /* Event of pLOStar containing Mjdate in pLOEventData or in pChunkEvents, returns 0 if there is no one */
+    int FindStarEvent( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar, const LOEventData * pLOEventData,
+                       const double Mjdate, double & EndOccTime ) const;
+
+    /* Text for std::cout and InfoMessage, kept in pChunkMessages if a chunk is processed */
+    void PrintMessage( const std::string & Text ) const;
+
+    void InfoMessage( const int Code, const std::string & Text ) const;
+
+    /* Distance (km) of the shadow axis from the Earth centre at CurrentStep of ChebValues */
+    double GetShadowDistance( const APSVec3 & eStar, const int CurrentStep ) const;
+
+    /* Steps [FirstStep,LastStep) of ChebValues where the shadow axis may come closer than Limit
+       to the Earth centre are added to pRuns as [first,last) pairs, neighbouring steps are joined.
+       Halves of the interval are tested only if ChebStepBound does not exclude an approach. */
+    void FindShadowRuns( const APSVec3 & eStar, const int FirstStep, const int LastStep, const int ScanStep,
+                         const double Limit, int * pRuns, int & RunsNumber ) const;
 
     int ProcessStar1( const LOAsteroid * pLOAsteroid, const LOStar * pLOStar, LOEventData * pLOEventData,
                       const double BeginMjdate, const double EndMjdate,
-                      const double ET_UT, const double Step, const int ScanStep );
+                      const double Step, const int ScanStep );
 
     int ProcessStarData( const LOAsteroid * pLOAsteroid, const APSVec3d * r_equ,
                          const double ETMjdate, const double Mjdate );
@@ -208,11 +353,54 @@ class LOCalc
 
     //int NewProcessAsteroid( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData );
 
+    int FillChebArray( const int ChebOrder, const double * cX, const double * cY, const double * cZ,
+                       const double BeginTime, const double EndTime,
+                       const double BeginMjdate, const double Step, const int ScanStep );
+
+    /* Creates the integrator of the asteroid and the first window of [MjdStart, MjdEnd] */
+    void OpenAsteroidScan( LOAsteroidScan & Scan, const LOAsteroid * pLOAsteroid ) const;
+
+    void CloseAsteroidScan( LOAsteroidScan & Scan ) const;
+
+    /* Chebyshev segment following the current one, returns 0 at MjdEnd */
+    int NextSegment( LOAsteroidScan & Scan ) const;
+
+    /* Star scan window of one day at most following the current one, returns 0 at MjdEnd */
+    int NextWindow( LOAsteroidScan & Scan ) const;
+
+    /* All Chebyshev segments and scan windows of the asteroid over [MjdStart, MjdEnd] */
+    void CreateWindows( const LOAsteroid * pLOAsteroid,
+                        std::vector<LOChebSegment> & Segments, std::vector<LOScanWindow> & Windows ) const;
+
+    int ProcessWindow( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData, LOEventData * pLOEventData,
+                       const LOChebSegment & Segment, const LOScanWindow & Window );
+
+    static void ProcessTimeChunk( LOTimeChunk * pChunk );
+
+    static void * ProcessTimeChunkThread( void * pArg );
+
+    /* Windows are split into chunks processed by threads, events are saved in chunk order */
+    int ProcessTimeChunks( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData, LOEventData * pLOEventData,
+                           const std::vector<LOChebSegment> & Segments, const std::vector<LOScanWindow> & Windows );
+
     int NewNewNewProcessAsteroid( const LOAsteroid * pLOAsteroid, const LOStarData * pLOStarData,
                                   LOEventData * pLOEventData );
 
+    /* Days in the outer loop, blocks of DayMajorBlock asteroids in the inner one.
+       Gives the same events as the asteroid-major order. It pays only when the star
+       regions and tables of one day don't stay in cache over a whole asteroid. */
+    int ProcessAsteroidsByDays( const LOAstOrbData * pLOAstOrbData, const LOStarData * pLOStarData,
+                                LOEventData * pLOEventData, const unsigned int FirstAsteroid );
+
     int IfAsteroid( const LOAsteroid * pLOAsteroid ) const;
 
+    /* First asteroid to process and counters of the resumed run */
+    int StartResume( const LOAstOrbData * pLOAstOrbData, unsigned int & FirstAsteroid );
+
+    /* Asteroids before NextAsteroid are processed, the events sink gets a checkpoint once in CHECKPOINT_PERIOD */
+    void SaveCheckpoint( const LOAstOrbData * pLOAstOrbData, LOEventData * pLOEventData,
+                         const unsigned int NextAsteroid, const bool IfForce );
+
     int ProcessManyAsteroids( const LOAstOrbData * pLOAstOrbData, const LOStarData * pLOStarData,
                               LOEventData * pLOEventData );
 
@@ -224,6 +412,10 @@ class LOCalc
 
     virtual ~LOCalc( void );
 
+    /* Run continues after the checkpoint, it must live until Run returns */
+    void SetResumeCheckpoint( const LOCheckpoint * apResumeCheckpoint )
+      { pResumeCheckpoint = apResumeCheckpoint; }
+
     int Run( LOData * pLOData );
 
     int OldReRun( void );
@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------------
+//
+// File:    loEtUtSubModule.cc
+//
+// Purpose: ET-UT table reading submodule.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include "loModuleCalc.h"
+#include "loEtUtSubModule.h"
+
+namespace aps {
+
+  namespace apslinoccult {
+
+//======================= LOEtUtSubModule ==========================
+
+LOEtUtSubModule :: LOEtUtSubModule( LOModuleCalc * pOwner ) :
+                                    APSSubModule( pOwner )
+{
+}
+
+LOEtUtSubModule :: ~LOEtUtSubModule( void )
+{
+}
+
+const LOModuleCalc * LOEtUtSubModule :: GetLOModuleCalcPtr( void ) const
+{
+  return( static_cast<const LOModuleCalc *>( GetOwnerPtr() ) );
+}
+
+
+}}
+
+//---------------------------- End of file ---------------------------
@@ -15,6 +15,16 @@
 //                                SunDist was added.
 //         version 0.6 22.02.2005 SunDist -> SunElev
 //         version 0.7 05.03.2005 StartSQLNumber was added.
+//         version 0.8 19.10.2026 KDTreeThreadsNumber was added
+//         version 0.9 19.10.2026 ChebTolerance, ChebMaxSegment, LO_CALC_CHEB_TOLERANCE were added
+//         version 0.10 19.10.2026 EtUtFilePath, LOEtUtSubModule were added
+//         version 0.11 19.10.2026 SiteConstraints, LO_CALC_SITE_CONSTRAINTS, LO_CALC_SITE_REJECTED were added
+//         version 0.12 19.10.2026 Star magnitude limit from minimal drop
+//         version 0.13 19.10.2026 Sun and Moon elongation culling
+//         version 0.14 19.10.2026 CalcThreadsNumber, LO_CALC_THREAD were added
+//         version 0.15 19.10.2026 DayMajorBlock, LO_CALC_DAY_MAJOR_BLOCK were added
+//         version 0.16 19.10.2026 LO_CALC_CHECKPOINT, LO_CALC_RESUME were added
+//         version 0.17 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -37,6 +47,7 @@
 #include "loChebMakerSubModule.h"
 #include "loChebSubModule.h"
 #include "loAstOrbSubModule.h"
+#include "loEtUtSubModule.h"
 
 namespace aps {
 
@@ -50,10 +61,12 @@ LOModuleCalc :: LOModuleCalc( LOCalcSubModule * pOwner ) :
   pLOChebMakerSubModule = new LOChebMakerSubModule( this );
   pLOAstOrbSubModule    = new LOAstOrbSubModule( this );
   pLOChebSubModule      = new LOChebSubModule( this );
+  pLOEtUtSubModule      = new LOEtUtSubModule( this );
 }
 
 LOModuleCalc :: ~LOModuleCalc( void )
 {
+  delete pLOEtUtSubModule;
   delete pLOChebSubModule;
   delete pLOAstOrbSubModule;
   delete pLOChebMakerSubModule;
@@ -88,6 +101,22 @@ const std::string LOModuleCalc :: GetMessageText( const int MsgNumber ) const
       return("Init jpl file.\n");
     case LO_CALC_TRANSFORM_EPOCH:
       return("Error in transform epoch.");
+    case LO_CALC_CHEB_TOLERANCE:
+      return("ChebTolerance was not reached, asteroid and segment start:\n");
+    case LO_CALC_SITE_CONSTRAINTS:
+      return("Union of sites constraints is applied:\n");
+    case LO_CALC_SITE_REJECTED:
+      return("Events rejected by sites constraints:\n");
+    case LO_CALC_ELONGATION_CULLED:
+      return("Asteroid-days skipped by Sun and Moon elongation:\n");
+    case LO_CALC_THREAD:
+      return("Can't create time chunk thread.\n");
+    case LO_CALC_DAY_MAJOR_BLOCK:
+      return("Start processing day-major block, asteroids:\n");
+    case LO_CALC_CHECKPOINT:
+      return("Checkpoint doesn't match asteroids data.\n");
+    case LO_CALC_RESUME:
+      return("Resume after asteroid:\n");
     default:;
   }
 
@@ -219,6 +248,61 @@ int LOModuleCalc :: GetStartSQLNumber( void ) const
   return( GetLOCalcSubModuleApplPtr()->GetStartSQLNumber() );
 }
 
+int LOModuleCalc :: GetKDTreeThreadsNumber( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetKDTreeThreadsNumber() );
+}
+
+double LOModuleCalc :: GetChebTolerance( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetChebTolerance() );
+}
+
+double LOModuleCalc :: GetChebMaxSegment( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetChebMaxSegment() );
+}
+
+const std::string & LOModuleCalc :: GetEtUtFilePath( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetEtUtFilePath() );
+}
+
+const std::string & LOModuleCalc :: GetTaiUtcFilePath( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetTaiUtcFilePath() );
+}
+
+int LOModuleCalc :: GetSiteConstraints( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetSiteConstraints() );
+}
+
+double LOModuleCalc :: GetCalcMinDrop( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetCalcMinDrop() );
+}
+
+double LOModuleCalc :: GetMinSunElongation( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetMinSunElongation() );
+}
+
+double LOModuleCalc :: GetMinMoonElongation( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetMinMoonElongation() );
+}
+
+int LOModuleCalc :: GetCalcThreadsNumber( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetCalcThreadsNumber() );
+}
+
+int LOModuleCalc :: GetDayMajorBlock( void ) const
+{
+  return( GetLOCalcSubModuleApplPtr()->GetDayMajorBlock() );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
@@ -15,6 +15,16 @@
 //                                SunDist was added.
 //         version 0.6 22.02.2005 SunDist -> SunElev
 //         version 0.7 05.03.2005 StartAsteroidNumber, EndAsteroidNumber, StartSQLNumber were added.
+//         version 0.8 19.10.2026 KDTreeThreadsNumber was added
+//         version 0.9 19.10.2026 ChebTolerance, ChebMaxSegment, LO_CALC_CHEB_TOLERANCE were added
+//         version 0.10 19.10.2026 EtUtFilePath, LOEtUtSubModule were added
+//         version 0.11 19.10.2026 SiteConstraints, LO_CALC_SITE_CONSTRAINTS, LO_CALC_SITE_REJECTED were added
+//         version 0.12 19.10.2026 Star magnitude limit from minimal drop
+//         version 0.13 19.10.2026 Sun and Moon elongation culling
+//         version 0.14 19.10.2026 CalcThreadsNumber, LO_CALC_THREAD were added
+//         version 0.15 19.10.2026 DayMajorBlock, LO_CALC_DAY_MAJOR_BLOCK were added
+//         version 0.16 19.10.2026 LO_CALC_CHECKPOINT, LO_CALC_RESUME were added
+//         version 0.17 19.10.2026 TaiUtcFilePath parameter
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -48,6 +58,7 @@ using apslib::APSModule;
 class LOCalcSubModule;
 class LOChebMakerSubModule;
 class LOChebSubModule;
+class LOEtUtSubModule;
 class LOAstOrbSubModule;
 
 enum {
@@ -63,7 +74,15 @@ enum {
   LO_CALC_FINISH_KDTREE,
   LO_CALC_KDTREE_BUILD_ERROR,
   LO_CALC_JPL_INIT,
-  LO_CALC_TRANSFORM_EPOCH
+  LO_CALC_TRANSFORM_EPOCH,
+  LO_CALC_CHEB_TOLERANCE,
+  LO_CALC_SITE_CONSTRAINTS,
+  LO_CALC_SITE_REJECTED,
+  LO_CALC_ELONGATION_CULLED,
+  LO_CALC_THREAD,
+  LO_CALC_DAY_MAJOR_BLOCK,
+  LO_CALC_CHECKPOINT,
+  LO_CALC_RESUME
 };
 
 //======================= LOModuleCalc ==========================
@@ -78,6 +97,8 @@ class LOModuleCalc : public APSModule
 
     LOAstOrbSubModule     * pLOAstOrbSubModule;
 
+    LOEtUtSubModule       * pLOEtUtSubModule;
+
     const LOCalcSubModule * GetLOCalcSubModuleApplPtr( void ) const;
 
   public:
@@ -97,6 +118,9 @@ class LOModuleCalc : public APSModule
     LOAstOrbSubModule * GetAstOrbSubModulePtr( void ) const
       { return( pLOAstOrbSubModule ); }
 
+    LOEtUtSubModule * GetEtUtSubModulePtr( void ) const
+      { return( pLOEtUtSubModule ); }
+
     const std::string & GetJPLEphemFilePath( void ) const;
 
     int GetStartYear( void ) const;
@@ -144,6 +168,28 @@ class LOModuleCalc : public APSModule
     double GetSunElev( void ) const;
 
     int GetStartSQLNumber( void ) const;
+
+    int GetKDTreeThreadsNumber( void ) const;
+
+    double GetChebTolerance( void ) const;
+
+    double GetChebMaxSegment( void ) const;
+
+    const std::string & GetEtUtFilePath( void ) const;
+
+    const std::string & GetTaiUtcFilePath( void ) const;
+
+    int GetSiteConstraints( void ) const;
+
+    double GetCalcMinDrop( void ) const;
+
+    double GetMinSunElongation( void ) const;
+
+    double GetMinMoonElongation( void ) const;
+
+    int GetCalcThreadsNumber( void ) const;
+
+    int GetDayMajorBlock( void ) const;
 };
 
 }}
@@ -0,0 +1,264 @@
+//------------------------------------------------------------------------------
+//
+// File:    loShadowMinima.cc
+//
+// Purpose: Closest approaches of asteroid shadow axis to the Earth centre.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Secant start, shared leaf slopes
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include <algorithm>
+
+#include "loShadowMinima.h"
+
+namespace aps {
+
+  namespace apslinoccult {
+
+const double TAU_EPS             = 1e-13;
+const int    MAX_ROOT_ITERATIONS = 60;
+
+//======================= LOShadowMinima ==========================
+
+int LOShadowMinima :: Set( const int aOrder, const double * cX, const double * cY, const double * cZ,
+                           const double ata, const double atb, const double AU, const double aFac )
+{
+  double Sum[ 3 ] = { 0.0, 0.0, 0.0 };
+  int    i;
+  int    k;
+
+  if( ( aOrder < 0 ) || ( aOrder > MAX_ORDER ) ) {
+    Order = -1;
+    return( 1 );
+  }
+
+  Order = aOrder;
+  ta    = ata;
+  tb    = atb;
+
+  for( i = 0; i <= Order; i++ ) {
+    r[ i ][ 0 ] = AU * cX[ i ];
+    r[ i ][ 1 ] = AU * cY[ i ];
+    r[ i ][ 2 ] = AU * cZ[ i ] / aFac;
+  }
+
+  Derivative( r, dr, Order );
+  Derivative( dr, ddr, Order );
+
+  // |T_i| <= 1, the first coefficient is taken with half weight
+  for( i = 0; i <= Order; i++ ) {
+    for( k = 0; k < 3; k++ ) {
+      Sum[ k ] += ( i ? 1.0 : 0.5 ) * fabs( dr[ i ][ k ] );
+    }
+  }
+
+  SpeedBound = sqrt( Sum[ 0 ] * Sum[ 0 ] + Sum[ 1 ] * Sum[ 1 ] + Sum[ 2 ] * Sum[ 2 ] );
+
+  return( 0 );
+}
+
+void LOShadowMinima :: Derivative( const double c[][ 3 ], double d[][ 3 ], const int Order )
+{
+  int i;
+  int k;
+
+  for( k = 0; k < 3; k++ ) {
+    d[ Order ][ k ] = 0.0;
+
+    if( Order > 0 ) {
+      d[ Order - 1 ][ k ] = 2.0 * Order * c[ Order ][ k ];
+    }
+
+    for( i = Order - 1; i >= 1; i-- ) {
+      d[ i - 1 ][ k ] = d[ i + 1 ][ k ] + 2.0 * i * c[ i ][ k ];
+    }
+  }
+}
+
+APSVec3 LOShadowMinima :: Clenshaw( const double c[][ 3 ], const int Order, const double tau )
+{
+  double  f1[ 3 ] = { 0.0, 0.0, 0.0 };
+  double  f2[ 3 ] = { 0.0, 0.0, 0.0 };
+  double  tau2    = 2.0 * tau;
+  double  old_f1;
+  APSVec3 Val;
+  int     i;
+  int     k;
+
+  for( i = Order; i >= 1; i-- ) {
+    for( k = 0; k < 3; k++ ) {
+      old_f1  = f1[ k ];
+      f1[ k ] = tau2 * f1[ k ] - f2[ k ] + c[ i ][ k ];
+      f2[ k ] = old_f1;
+    }
+  }
+
+  for( k = 0; k < 3; k++ ) {
+    Val.v[ k ] = tau * f1[ k ] - f2[ k ] + 0.5 * c[ 0 ][ k ];
+  }
+
+  return( Val );
+}
+
+double LOShadowMinima :: GetDistance( const APSVec3 & eStar, const double tau ) const
+{
+  APSVec3 rAst = Clenshaw( r, Order, tau );
+  double  s0   = Dot( rAst, eStar );
+
+  return( sqrt( std::max( Dot( rAst, rAst ) - s0 * s0, 0.0 ) ) );
+}
+
+double LOShadowMinima :: GetSlope( const APSVec3 & eStar, const double tau, double * pDerivative ) const
+{
+  APSVec3 rAst = Clenshaw( r, Order, tau );
+  APSVec3 vAst = Clenshaw( dr, Order, tau );
+  APSVec3 aAst;
+  double  rs   = Dot( rAst, eStar );
+  double  vs   = Dot( vAst, eStar );
+
+  if( pDerivative ) {
+    aAst = Clenshaw( ddr, Order, tau );
+
+    *pDerivative = Dot( vAst, vAst ) + Dot( rAst, aAst ) - vs * vs - rs * Dot( aAst, eStar );
+  }
+
+  return( Dot( rAst, vAst ) - rs * vs );
+}
+
+double LOShadowMinima :: FindRoot( const APSVec3 & eStar, double a, double b, const double SlopeA, const double SlopeB ) const
+{
+  double x = a - SlopeA * ( b - a ) / ( SlopeB - SlopeA ); // Slope is nearly linear in one Step
+  double NewX;
+  double Slope;
+  double Derivative;
+  int    i;
+
+  // Slope is negative at a and not negative at b
+  for( i = 0; i < MAX_ROOT_ITERATIONS; i++ ) {
+    Slope = GetSlope( eStar, x, &Derivative );
+
+    if( Slope < 0.0 ) {
+      a = x;
+    }
+    else {
+      b = x;
+    }
+
+    if( b - a < TAU_EPS ) {
+      break;
+    }
+
+    NewX = x - Slope / Derivative;
+
+    if( !( Derivative > 0.0 ) || !( NewX > a ) || !( NewX < b ) ) {
+      NewX = 0.5 * ( a + b );
+    }
+
+    if( fabs( NewX - x ) < TAU_EPS ) {
+      x = NewX;
+      break;
+    }
+
+    x = NewX;
+  }
+
+  return( x );
+}
+
+void LOShadowMinima :: Search( const APSVec3 & eStar, const double a, const double b, const double tau1, const double tau2,
+                               const double Limit, const double LeafWidth, double * pTimes, int & Number, const int MaxNumber,
+                               double & LastTau, double & LastSlope ) const
+{
+  double Middle = 0.5 * ( a + b );
+  double SlopeA;
+  double SlopeB;
+  double Tau;
+
+  // Distance changes not faster than the asteroid moves
+  if( GetDistance( eStar, Middle ) - SpeedBound * 0.5 * ( b - a ) >= Limit ) {
+    return;
+  }
+
+  if( b - a > LeafWidth ) {
+    Search( eStar, a, Middle, tau1, tau2, Limit, LeafWidth, pTimes, Number, MaxNumber, LastTau, LastSlope );
+    Search( eStar, Middle, b, tau1, tau2, Limit, LeafWidth, pTimes, Number, MaxNumber, LastTau, LastSlope );
+    return;
+  }
+
+  // Neighbouring leaves share the end
+  SlopeA = ( a == LastTau ) ? LastSlope : GetSlope( eStar, a, 0 );
+  SlopeB = GetSlope( eStar, b, 0 );
+
+  LastTau   = b;
+  LastSlope = SlopeB;
+
+  // A minimum at the common end of two intervals is taken by the right one
+  if( ( a == tau1 ) && ( SlopeA >= 0.0 ) && ( Number < MaxNumber ) && ( GetDistance( eStar, a ) < Limit ) ) {
+    pTimes[ Number++ ] = GetTime( a );
+  }
+
+  if( ( SlopeA < 0.0 ) && ( SlopeB >= 0.0 ) ) {
+    Tau = FindRoot( eStar, a, b, SlopeA, SlopeB );
+
+    if( ( Number < MaxNumber ) && ( GetDistance( eStar, Tau ) < Limit ) ) {
+      pTimes[ Number++ ] = GetTime( Tau );
+    }
+  }
+
+  if( ( b == tau2 ) && ( SlopeB < 0.0 ) && ( Number < MaxNumber ) && ( GetDistance( eStar, b ) < Limit ) ) {
+    pTimes[ Number++ ] = GetTime( b );
+  }
+}
+
+int LOShadowMinima :: Find( const APSVec3 & eStar, const double BeginMjdate, const double EndMjdate,
+                            const double FirstMjdate, const double LastMjdate, const double Limit,
+                            const double LeafWidth, double * pTimes, const int MaxNumber ) const
+{
+  double tau1;
+  double tau2;
+  double a;
+  double b;
+  double LastTau   = 2.0;   // Outside of [-1,1]
+  double LastSlope = 0.0;
+  int    Number    = 0;
+
+  if( ( Order < 0 ) || !( tb > ta ) || ( MaxNumber <= 0 ) ) {
+    return( Number );
+  }
+
+  tau1 = GetTau( std::max( BeginMjdate, ta ) );
+  tau2 = GetTau( std::min( EndMjdate, tb ) );
+
+  a = std::max( GetTau( FirstMjdate ), tau1 );
+  b = std::min( GetTau( LastMjdate ), tau2 );
+
+  if( a < b ) {
+    Search( eStar, a, b, tau1, tau2, Limit, 2.0 * LeafWidth / ( tb - ta ), pTimes, Number, MaxNumber,
+            LastTau, LastSlope );
+  }
+
+  return( Number );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,121 @@
+//------------------------------------------------------------------------------
+//
+// File:    loShadowMinima.h
+//
+// Purpose: Closest approaches of asteroid shadow axis to the Earth centre.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Secant start, shared leaf slopes
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef LO_SHADOW_MINIMA_H
+#define LO_SHADOW_MINIMA_H
+
+#include "apsvec3.h"
+
+namespace aps {
+
+  namespace apslinoccult {
+
+using apsmathlib::APSVec3;
+
+//======================= LOShadowMinima ==========================
+
+/*
+  Geocentric asteroid position r(t) is a Chebyshev approximation, the star
+  direction e is fixed, so the squared distance of the shadow axis from the
+  Earth centre f = |r|^2 - (r*e)^2 and its derivative are evaluated from the
+  series of r, r' and r'' without sampling. Find gives local minima of f
+  below the limit: intervals are halved until the distance at the middle and
+  the bound of |r'| exclude an approach, in short intervals minima are the
+  roots of f' found by Newton steps bracketed by bisection.
+  Positions are in km with z divided by fac, as in LOCalc :: ProcessStar1.
+*/
+
+class LOShadowMinima
+{
+  public:
+
+    static const int MAX_ORDER = 15;
+
+  private:
+
+    double r[ MAX_ORDER + 1 ][ 3 ];    // Position series
+    double dr[ MAX_ORDER + 1 ][ 3 ];   // Velocity series, per unit of tau
+    double ddr[ MAX_ORDER + 1 ][ 3 ];  // Acceleration series, per unit of tau^2
+    double ta;
+    double tb;
+    double SpeedBound;                 // km per unit of tau
+    int    Order;
+
+    static void Derivative( const double c[][ 3 ], double d[][ 3 ], const int Order );
+
+    static APSVec3 Clenshaw( const double c[][ 3 ], const int Order, const double tau );
+
+    double GetTau( const double t ) const
+      { return( ( 2.0 * t - ta - tb ) / ( tb - ta ) ); }
+
+    double GetTime( const double tau ) const
+      { return( 0.5 * ( ( tb - ta ) * tau + ta + tb ) ); }
+
+    double GetDistance( const APSVec3 & eStar, const double tau ) const;
+
+    /* f' / 2, and f'' / 2 if pDerivative is given */
+    double GetSlope( const APSVec3 & eStar, const double tau, double * pDerivative ) const;
+
+    double FindRoot( const APSVec3 & eStar, double a, double b, const double SlopeA, const double SlopeB ) const;
+
+    /* LastTau and LastSlope keep the slope at the right end of the previous leaf */
+    void Search( const APSVec3 & eStar, const double a, const double b, const double tau1, const double tau2,
+                 const double Limit, const double LeafWidth, double * pTimes, int & Number, const int MaxNumber,
+                 double & LastTau, double & LastSlope ) const;
+
+  public:
+
+    LOShadowMinima( void ) : ta( 0.0 ), tb( 0.0 ), SpeedBound( 0.0 ), Order( -1 )
+      {}
+
+    /* Coefficients are in AU as made by LOAstOrbChebMaker, z is divided by aFac.
+       Returns 1 if aOrder is greater than MAX_ORDER. */
+    int Set( const int aOrder, const double * cX, const double * cY, const double * cZ,
+             const double ata, const double atb, const double AU, const double aFac );
+
+    /* Times of local minima of the axis distance in [FirstMjdate,LastMjdate] part of the
+       window [BeginMjdate,EndMjdate], where it may be below Limit (km), in ascending order.
+       Minima at ends of the part are taken only at ends of the window. LeafWidth (days) is
+       the longest interval searched for a single minimum. Returns number of times. */
+    int Find( const APSVec3 & eStar, const double BeginMjdate, const double EndMjdate,
+              const double FirstMjdate, const double LastMjdate, const double Limit,
+              const double LeafWidth, double * pTimes, const int MaxNumber ) const;
+
+    /* Bound of the position change (km) in Duration days, rigorous for the series */
+    double GetMotionBound( const double Duration ) const
+      { return( SpeedBound * 2.0 * Duration / ( tb - ta ) ); }
+
+    /* Position in km with z divided by fac */
+    APSVec3 GetPosition( const double t ) const
+      { return( Clenshaw( r, Order, GetTau( t ) ) ); }
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,196 @@
+//------------------------------------------------------------------------------
+//
+// File:    testeventdata.cc
+//
+// Purpose: Test of LOEventData asteroid and star indexes.
+//          Returns 1 if an index lookup does not match a linear scan
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <iostream>
+
+#include "loEventData.h"
+#include "loEvent.h"
+#include "loPointEvent.h"
+
+using aps::apslinoccult::LOEventData;
+using aps::apslinoccult::LOEvent;
+using aps::apslinoccult::LOPointEventItem;
+
+const int    ASTEROIDS    = 7;     // Asteroid IDs 1 - ASTEROIDS
+const int    STARS        = 5;     // Star numbers 1 - STARS in two catalogs
+const int    EVENTS       = 300;   // Events before Rebuild
+const int    LATE_EVENTS  = 20;    // Events after Rebuild
+const short  CHEB_ORDER   = 2;
+const double MJD_START    = 60000.0;
+
+static const LOEvent * CreateEvent( LOEventData & EventData, const int Number )
+{
+  const double Coefs[ CHEB_ORDER + 1 ] = { 1.0, 0.0, 0.0 };
+  const double Mjd = MJD_START + ( Number * 37 % EVENTS ) * 0.5; // not in date order
+
+  return( EventData.CreateEvent( Number % ASTEROIDS + 1, "Test", 10.0, 0.1, MJD_START,
+                                 0.0, 0.0, 0.0, 0.0, 0.1, 2.5,
+                                 static_cast<unsigned char>( Number % 2 ), Number % STARS + 1,
+                                 1000, CHEB_ORDER, Coefs, Coefs, Coefs,
+                                 69.0 / 86400.0, Mjd, Mjd + 0.001, 0, 10.0,
+                                 0.0, 0.0, 0.5, 90.0, 90.0, 0.0, 1.0, 1.0 ) );
+}
+
+// Counts events of AsteroidID and checks that the index range has them all
+static int TestAsteroid( const LOEventData & EventData, const int AsteroidID )
+{
+  unsigned int First;
+  unsigned int Last;
+  unsigned int Number = 0;
+  unsigned int i;
+
+  for( i = 0; i < EventData.GetEventsNumber(); i++ ) {
+    if( EventData.GetEventPtr( i )->GetAsteroidID() == AsteroidID ) {
+      Number++;
+    }
+  }
+
+  EventData.FindEventsByAsteroid( AsteroidID, First, Last );
+
+  for( i = First; i < Last; i++ ) {
+    if( EventData.GetAsteroidEventPtr( i )->GetAsteroidID() != AsteroidID ) {
+      return( 1 );
+    }
+  }
+
+  return( Last - First == Number ? 0 : 1 );
+}
+
+static int TestStar( const LOEventData & EventData, const unsigned char Catalog, const int StarNumber )
+{
+  unsigned int First;
+  unsigned int Last;
+  unsigned int Number = 0;
+  unsigned int i;
+
+  for( i = 0; i < EventData.GetEventsNumber(); i++ ) {
+    if( ( EventData.GetEventPtr( i )->GetCatalog() == Catalog ) &&
+        ( EventData.GetEventPtr( i )->GetStarNumber() == StarNumber ) ) {
+      Number++;
+    }
+  }
+
+  EventData.FindEventsByStar( Catalog, StarNumber, First, Last );
+
+  for( i = First; i < Last; i++ ) {
+    if( ( EventData.GetStarEventPtr( i )->GetCatalog() != Catalog ) ||
+        ( EventData.GetStarEventPtr( i )->GetStarNumber() != StarNumber ) ) {
+      return( 1 );
+    }
+  }
+
+  return( Last - First == Number ? 0 : 1 );
+}
+
+// Every event must be found by FindEvent, indexed or created after Rebuild
+static int TestFindEvent( const LOEventData & EventData )
+{
+  const LOEvent * pLOEvent;
+  unsigned int    i;
+
+  for( i = 0; i < EventData.GetEventsNumber(); i++ ) {
+    pLOEvent = EventData.GetEventPtr( i );
+
+    if( EventData.FindEvent( pLOEvent->GetAsteroidID(), pLOEvent->GetCatalog(), pLOEvent->GetStarNumber(),
+                             pLOEvent->GetBeginOccTime() ) != pLOEvent ) {
+      return( 1 );
+    }
+  }
+
+  return( 0 );
+}
+
+// Point event lists must move with their events in Rebuild
+static int TestPointEvents( const LOEventData & EventData )
+{
+  const LOPointEventItem * pLOPointEventItem;
+  int                      Number;
+  int                      i;
+
+  for( i = 0; i < EVENTS; i++ ) {
+    Number = 0;
+
+    for( pLOPointEventItem = EventData.GetEventPtr( i )->GetFirstPointEventItem(); pLOPointEventItem;
+         pLOPointEventItem = pLOPointEventItem->GetNextPointEventItemPtr() ) {
+      Number++;
+    }
+
+    if( Number != EventData.GetEventPtr( i )->GetStarNumber() % 3 ) {
+      return( 1 );
+    }
+  }
+
+  return( 0 );
+}
+
+int main( void )
+{
+  LOEventData  EventData;
+  int          Errors = 0;
+  int          i;
+
+  // Point events are not dereferenced by the list
+  for( i = 0; i < EVENTS; i++ ) {
+    const LOEvent * pLOEvent = CreateEvent( EventData, i );
+
+    for( int j = 0; j < pLOEvent->GetStarNumber() % 3; j++ ) {
+      pLOEvent->AddPointEvent( 0 );
+    }
+  }
+
+  EventData.Rebuild();
+
+  for( i = 1; i <= ASTEROIDS + 1; i++ ) {
+    Errors += TestAsteroid( EventData, i );
+  }
+
+  for( i = 1; i <= STARS + 1; i++ ) {
+    Errors += TestStar( EventData, 0, i );
+    Errors += TestStar( EventData, 1, i );
+  }
+
+  for( i = EVENTS; i < EVENTS + LATE_EVENTS; i++ ) {
+    CreateEvent( EventData, i );
+  }
+
+  Errors += TestFindEvent( EventData );
+
+  Errors += TestPointEvents( EventData );
+
+  std::cout << EventData.GetEventsNumber() << " events, " << Errors << " errors" << std::endl;
+
+  if( Errors > 0 ) {
+    std::cout << "FAILED" << std::endl;
+    return( 1 );
+  }
+
+  std::cout << "OK" << std::endl;
+
+  return( 0 );
+}
+
+//---------------------------- End of file ---------------------------
@@ -10,6 +10,7 @@
 // version 0.2 11.04.2004 diameter has been added
 // version 0.3 10.06.2004 Brigteness, EphemerisUncertainty have been added
 // version 0.4 15.02.2005 Slope was added
+// version 0.5 19.10.2026 Asteroids are allocated in pool
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -29,6 +30,7 @@
 
 #include "loAstOrbData.h"
 #include "loAsteroid.h"
+#include "apspool.h"
 
 namespace aps {
 
@@ -36,7 +38,8 @@ namespace aps {
 
 //======================= LOAstOrbData ==========================
 
-LOAstOrbData :: LOAstOrbData( const unsigned int aAsteroidsNumber ) :
+LOAstOrbData :: LOAstOrbData( const unsigned int aAsteroidsNumber, APSPool<LOAsteroid> * apLOAsteroidPool ) :
+                              pLOAsteroidPool( apLOAsteroidPool ),
                               AsteroidsNumber( aAsteroidsNumber ),
                               CurrentNumber( 0 )
 {
@@ -45,13 +48,9 @@ LOAstOrbData :: LOAstOrbData( const unsigned int aAsteroidsNumber ) :
 
 LOAstOrbData :: ~LOAstOrbData( void )
 {
-  unsigned int i;
+  /* asteroids are released with pool */
 
-  for( i = 0; i < CurrentNumber; i++ ) {
-    delete ppLOAsteroidArray[ i ];
-  }
-
-  delete ppLOAsteroidArray;
+  delete [] ppLOAsteroidArray;
 }
 
 LOAsteroid * LOAstOrbData :: CreateAsteroid( const int AsteroidID,
@@ -65,7 +64,7 @@ LOAsteroid * LOAstOrbData :: CreateAsteroid( const int AsteroidID,
   LOAsteroid * pLOAsteroid = 0;
 
   if( CurrentNumber < AsteroidsNumber ) {
-    pLOAsteroid = new LOAsteroid( AsteroidID, AsteroidName, ObservationEpoch,
+    pLOAsteroid = new ( pLOAsteroidPool->Allocate() ) LOAsteroid( AsteroidID, AsteroidName, ObservationEpoch,
                                   M, W, O, I, E, A, Diameter, Brigteness, Slope, EphemerisUncertainty );
 
     ppLOAsteroidArray[ CurrentNumber ] = pLOAsteroid;
@@ -10,6 +10,7 @@
 // version 0.2 11.04.2004 diameter has been added
 // version 0.3 10.06.2004 Brigteness, EphemerisUncertainty have been added
 // version 0.4 15.02.2005 Slope was added
+// version 0.5 19.10.2026 Asteroids are allocated in pool
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -34,8 +35,14 @@
 
 namespace aps {
 
+  namespace apslib {
+    template<class T> class APSPool;
+  }
+
   namespace apslinoccult {
 
+using apslib::APSPool;
+
 class LOAsteroid;
 
 //======================= LOAstOrbData ==========================
@@ -44,13 +51,14 @@ class LOAstOrbData
 {
   private:
 
-    LOAsteroid   ** ppLOAsteroidArray;
-    unsigned int    AsteroidsNumber;
-    unsigned int    CurrentNumber;
+    LOAsteroid          ** ppLOAsteroidArray;
+    APSPool<LOAsteroid>  * pLOAsteroidPool;
+    unsigned int           AsteroidsNumber;
+    unsigned int           CurrentNumber;
 
   public:
 
-    LOAstOrbData( const unsigned int aAsteroidsNumber );
+    LOAstOrbData( const unsigned int aAsteroidsNumber, APSPool<LOAsteroid> * apLOAsteroidPool );
 
     virtual ~LOAstOrbData( void );
 
@@ -12,6 +12,8 @@
 //         version 0.4 17.02.2005 Positions were added
 //         version 0.5 27.02.2005 LOPointEventData was added
 //         version 0.6 17.04.2005 LOUpdateData was added
+//         version 0.7 19.10.2026 Object pools
+//         version 0.8 19.10.2026 Parallel kd-tree build
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -36,6 +38,10 @@
 #include "loPosData.h"
 #include "loPointEventData.h"
 #include "loUpdateData.h"
+#include "loStar.h"
+#include "loAsteroid.h"
+#include "loPointEvent.h"
+#include "apspool.h"
 
 namespace aps {
 
@@ -50,6 +56,9 @@ LOData :: LOData( void ) : pLOAstOrbData( 0 ),
                            pLOPointEventData( 0 ),
                            pLOUpdateData( 0 )
 {
+  pLOStarPool       = new APSPool<LOStar>( 65536 );
+  pLOAsteroidPool   = new APSPool<LOAsteroid>( 16384 );
+  pLOPointEventPool = new APSPool<LOPointEvent>( 16384 );
 }
 
 LOData :: ~LOData( void )
@@ -77,12 +86,16 @@ LOData :: ~LOData( void )
   if( pLOUpdateData ) {
     delete pLOUpdateData;
   }
+
+  delete pLOStarPool;
+  delete pLOAsteroidPool;
+  delete pLOPointEventPool;
 }
 
 LOAstOrbData * LOData :: CreateAstOrbData( const unsigned int AsteroidsNumber )
 {
   if( !pLOAstOrbData ) {
-    pLOAstOrbData = new LOAstOrbData( AsteroidsNumber );
+    pLOAstOrbData = new LOAstOrbData( AsteroidsNumber, pLOAsteroidPool );
   }
 
   return( pLOAstOrbData );
@@ -91,7 +104,7 @@ LOAstOrbData * LOData :: CreateAstOrbData( const unsigned int AsteroidsNumber )
 LOStarData * LOData :: CreateStarData( const unsigned int StarsNumber )
 {
   if( !pLOStarData ) {
-    pLOStarData = new LOStarData( StarsNumber );
+    pLOStarData = new LOStarData( StarsNumber, pLOStarPool );
   }
 
   return( pLOStarData );
@@ -118,7 +131,7 @@ LOPosData * LOData :: CreatePosData( void )
 LOPointEventData * LOData :: CreatePointEventData( void )
 {
   if( !pLOPointEventData ) {
-    pLOPointEventData = new LOPointEventData();
+    pLOPointEventData = new LOPointEventData( pLOPointEventPool );
   }
 
   return( pLOPointEventData );
@@ -133,14 +146,14 @@ LOUpdateData * LOData :: CreateUpdateData( void )
   return( pLOUpdateData );
 }
 
-int LOData :: BuildKDTree( void ) const
+int LOData :: BuildKDTree( const int ThreadsNumber ) const
 {
   int RetCode;
 
   RetCode = 0;
 
   if( pLOStarData ) {
-    if( pLOStarData->BuildKDTree() ) {
+    if( pLOStarData->BuildKDTree( ThreadsNumber ) ) {
       RetCode = 2;
     }
   }
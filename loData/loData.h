@@ -12,6 +12,8 @@
 //         version 0.4 17.02.2005 Positions were added
 //         version 0.5 27.02.2005 LOPointEventData was added
 //         version 0.6 17.04.2005 LOUpdateData was added
+//         version 0.7 19.10.2026 Object pools
+//         version 0.8 19.10.2026 Parallel kd-tree build
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -34,14 +36,23 @@
 
 namespace aps {
 
+  namespace apslib {
+    template<class T> class APSPool;
+  }
+
   namespace apslinoccult {
 
+using apslib::APSPool;
+
 class LOAstOrbData;
 class LOStarData;
 class LOEventData;
 class LOPosData;
 class LOPointEventData;
 class LOUpdateData;
+class LOStar;
+class LOAsteroid;
+class LOPointEvent;
 
 //======================= LOData ==========================
 
@@ -56,6 +67,10 @@ class LOData
     LOPointEventData * pLOPointEventData;
     LOUpdateData     * pLOUpdateData;
 
+    APSPool<LOStar>       * pLOStarPool;
+    APSPool<LOAsteroid>   * pLOAsteroidPool;
+    APSPool<LOPointEvent> * pLOPointEventPool;
+
   public:
 
     LOData( void );
@@ -92,7 +107,8 @@ class LOData
     LOUpdateData * GetUpdateData( void ) const
       { return( pLOUpdateData ); }
 
-    int BuildKDTree( void ) const;
+    /* ThreadsNumber <= 0 means all online processors */
+    int BuildKDTree( const int ThreadsNumber ) const;
 };
 
 }}
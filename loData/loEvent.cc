@@ -9,6 +9,9 @@
 // Initial version 0.1 06.02.2005
 //         version 0.2 27.02.2005 LOPointEventList was added
 //         version 0.3 24.03.2005 GetFirstPointEventItem was added
+//         version 0.4 19.10.2026 Asteroid data and coefficients are shared in LOEventData
+//         version 0.5 19.10.2026 Coefficients can be dropped after the event sink
+//         version 0.6 19.10.2026 LOEvent owns its point event list and is move-only
 // 
 // 
 // This program is free software; you can redistribute it and/or
@@ -29,71 +32,169 @@
 
 #include "loEvent.h"
 #include "loPointEvent.h"
+#include "loEventData.h"
+#include "loEventAsteroid.h"
 
 namespace aps {
 
   namespace apslinoccult {
 
-LOEvent :: LOEvent( const int aAsteroidID, const std::string & aAsteroidName,
-                    const double aDiameter, const double aEphemerisUncertainty,
-                    const double aObservationEpoch,
-                    const double aM, const double aW, const double aO,
-                    const double aI, const double aE, const double aA,
+LOEvent :: LOEvent( const LOEventData * apLOEventData, const unsigned int aAsteroidIndex,
+                    const int aAsteroidID, const double aEphemerisUncertainty,
                     const unsigned char aCatalog, const int aStarNumber,
-                    const short aMv, const short aChebOrder,
-                    const double * apcX, const double * apcY, const double * apcZ,
+                    const short aMv, const short aChebOrder, const unsigned int aCoefOffset,
                     const double aET_UT,
                     const double aBeginOccTime, const double aEndOccTime,
                     const int aEarthFlag, const double aMaxDuration,
                     const double aStarRA, const double aStarDec,
                     const double aMoonPhase, const double aSunDist,
                     const double aMoonDist, const double aBrightness,
-                    const double aBrightDelta, const double aUncertainty,
-                    LOEvent * apNext ) :
-           AsteroidID( aAsteroidID ), AsteroidName( aAsteroidName ),
-           Diameter( aDiameter ), EphemerisUncertainty( aEphemerisUncertainty ),
-           ObservationEpoch( aObservationEpoch ),
-           M( aM ), W( aW ), O( aO ), I( aI ), E( aE ), A( aA ),
-           Catalog( aCatalog ), StarNumber( aStarNumber ),
-           Mv( aMv ), ChebOrder( aChebOrder ),
+                    const double aBrightDelta, const double aUncertainty ) :
+           pLOEventData( apLOEventData ), pLOPointEventList( 0 ),
+           AsteroidIndex( aAsteroidIndex ), CoefOffset( aCoefOffset ),
+           AsteroidID( aAsteroidID ), StarNumber( aStarNumber ),
+           EarthFlag( aEarthFlag ), Mv( aMv ), ChebOrder( aChebOrder ),
+           Catalog( aCatalog ), EphemerisUncertainty( aEphemerisUncertainty ),
            ET_UT( aET_UT ), BeginOccTime( aBeginOccTime ),
-           EndOccTime( aEndOccTime ), EarthFlag( aEarthFlag ),
-           MaxDuration( aMaxDuration ), StarRA( aStarRA ),
-           StarDec( aStarDec ), MoonPhase( aMoonPhase ),
+           EndOccTime( aEndOccTime ), MaxDuration( aMaxDuration ),
+           StarRA( aStarRA ), StarDec( aStarDec ), MoonPhase( aMoonPhase ),
            SunDist( aSunDist ), MoonDist( aMoonDist ),
            Brightness( aBrightness ), BrightDelta( aBrightDelta ),
-           Uncertainty( aUncertainty ), pNext( apNext )
+           Uncertainty( aUncertainty )
 {
-  pLOPointEventList    = new LOPointEventList();
+}
+
+LOEvent :: LOEvent( LOEvent && aLOEvent ) noexcept :
+           pLOEventData( aLOEvent.pLOEventData ), pLOPointEventList( aLOEvent.pLOPointEventList ),
+           AsteroidIndex( aLOEvent.AsteroidIndex ), CoefOffset( aLOEvent.CoefOffset ),
+           AsteroidID( aLOEvent.AsteroidID ), StarNumber( aLOEvent.StarNumber ),
+           EarthFlag( aLOEvent.EarthFlag ), Mv( aLOEvent.Mv ), ChebOrder( aLOEvent.ChebOrder ),
+           Catalog( aLOEvent.Catalog ), EphemerisUncertainty( aLOEvent.EphemerisUncertainty ),
+           ET_UT( aLOEvent.ET_UT ), BeginOccTime( aLOEvent.BeginOccTime ),
+           EndOccTime( aLOEvent.EndOccTime ), MaxDuration( aLOEvent.MaxDuration ),
+           StarRA( aLOEvent.StarRA ), StarDec( aLOEvent.StarDec ),
+           MoonPhase( aLOEvent.MoonPhase ), SunDist( aLOEvent.SunDist ),
+           MoonDist( aLOEvent.MoonDist ), Brightness( aLOEvent.Brightness ),
+           BrightDelta( aLOEvent.BrightDelta ), Uncertainty( aLOEvent.Uncertainty )
+{
+  aLOEvent.pLOPointEventList = 0;
+}
+
+LOEvent & LOEvent :: operator=( LOEvent && aLOEvent ) noexcept
+{
+  if( this != &aLOEvent ) {
+    delete pLOPointEventList;
 
-  pcX = new double[ aChebOrder + 1 ];
-  pcY = new double[ aChebOrder + 1 ];
-  pcZ = new double[ aChebOrder + 1 ];
+    pLOEventData         = aLOEvent.pLOEventData;
+    pLOPointEventList    = aLOEvent.pLOPointEventList;
+    AsteroidIndex        = aLOEvent.AsteroidIndex;
+    CoefOffset           = aLOEvent.CoefOffset;
+    AsteroidID           = aLOEvent.AsteroidID;
+    StarNumber           = aLOEvent.StarNumber;
+    EarthFlag            = aLOEvent.EarthFlag;
+    Mv                   = aLOEvent.Mv;
+    ChebOrder            = aLOEvent.ChebOrder;
+    Catalog              = aLOEvent.Catalog;
+    EphemerisUncertainty = aLOEvent.EphemerisUncertainty;
+    ET_UT                = aLOEvent.ET_UT;
+    BeginOccTime         = aLOEvent.BeginOccTime;
+    EndOccTime           = aLOEvent.EndOccTime;
+    MaxDuration          = aLOEvent.MaxDuration;
+    StarRA               = aLOEvent.StarRA;
+    StarDec              = aLOEvent.StarDec;
+    MoonPhase            = aLOEvent.MoonPhase;
+    SunDist              = aLOEvent.SunDist;
+    MoonDist             = aLOEvent.MoonDist;
+    Brightness           = aLOEvent.Brightness;
+    BrightDelta          = aLOEvent.BrightDelta;
+    Uncertainty          = aLOEvent.Uncertainty;
 
-  for( int i = 0; i <= aChebOrder; i++ ) {
-    pcX[ i ] = apcX[ i ];
-    pcY[ i ] = apcY[ i ];
-    pcZ[ i ] = apcZ[ i ];
+    aLOEvent.pLOPointEventList = 0;
   }
+
+  return( *this );
 }
 
 LOEvent :: ~LOEvent( void )
 {
   delete pLOPointEventList;
-
-  delete [] pcX;
-  delete [] pcY;
-  delete [] pcZ;
 }
 
 void LOEvent :: AddPointEvent( const LOPointEvent * pLOPointEvent ) const
 {
+  if( !pLOPointEventList ) {
+    pLOPointEventList = new LOPointEventList();
+  }
+
   pLOPointEventList->AddPointEvent( pLOPointEvent );
 }
 
 const LOPointEventItem * LOEvent :: GetFirstPointEventItem( void ) const
 {
-  return( pLOPointEventList->GetFirstPointEventItem() );
+  if( pLOPointEventList ) {
+    return( pLOPointEventList->GetFirstPointEventItem() );
+  }
+
+  return( 0 );
+}
+
+const std::string & LOEvent :: GetAsteroidNamePtr( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetAsteroidNamePtr() );
+}
+
+double LOEvent :: GetDiameter( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetDiameter() );
+}
+
+double LOEvent :: GetObservationEpoch( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetObservationEpoch() );
+}
+
+double LOEvent :: GetM( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetM() );
+}
+
+double LOEvent :: GetW( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetW() );
+}
+
+double LOEvent :: GetO( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetO() );
+}
+
+double LOEvent :: GetI( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetI() );
+}
+
+double LOEvent :: GetE( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetE() );
+}
+
+double LOEvent :: GetA( void ) const
+{
+  return( pLOEventData->GetEventAsteroidPtr( AsteroidIndex )->GetA() );
+}
+
+void LOEvent :: DropCoefs( void )
+{
+  CoefOffset = LOEventData :: NO_COEFS;
+}
+
+const double * LOEvent :: GetcX( void ) const
+{
+  if( CoefOffset == LOEventData :: NO_COEFS ) {
+    return( 0 );
+  }
+
+  return( pLOEventData->GetCoefPtr( CoefOffset ) );
 }
 
 }}
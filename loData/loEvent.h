@@ -9,6 +9,9 @@
 // Initial version 0.1 06.02.2005
 //         version 0.2 27.02.2005 LOPointEventList was added
 //         version 0.3 24.03.2005 GetFirstPointEventItem was added
+//         version 0.4 19.10.2026 Asteroid data and coefficients are shared in LOEventData
+//         version 0.5 19.10.2026 Coefficients can be dropped after the event sink
+//         version 0.6 19.10.2026 LOEvent owns its point event list and is move-only
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -38,107 +41,101 @@ namespace aps {
 class LOPointEventList;
 class LOPointEventItem;
 class LOPointEvent;
+class LOEventData;
 
 //======================= LOEvent ==========================
 
+/*
+  Event is stored by value in LOEventData. Asteroid data and Chebyshev
+  coefficients are kept once in LOEventData tables and referenced by index.
+  Event owns its point event list, so it can be moved but not copied.
+*/
+
 class LOEvent
 {
   private:
 
-    LOPointEventList * pLOPointEventList;
-    int                AsteroidID;
-    std::string        AsteroidName;
-    double             Diameter;
-    double             EphemerisUncertainty;
-    double             ObservationEpoch;
-    double             M;
-    double             W;
-    double             O;
-    double             I;
-    double             E;
-    double             A;
-    unsigned char      Catalog;
-    int                StarNumber;
-    short              Mv;
-    short              ChebOrder;
-    double           * pcX;
-    double           * pcY;
-    double           * pcZ;
-    double             ET_UT;
-    double             BeginOccTime;
-    double             EndOccTime;
-    int                EarthFlag;
-    double             MaxDuration;
-    double             StarRA;
-    double             StarDec;
-    double             MoonPhase;
-    double             SunDist;
-    double             MoonDist;
-    double             Brightness;
-    double             BrightDelta;
-    double             Uncertainty;
-    LOEvent          * pNext;
+    const LOEventData        * pLOEventData;
+    mutable LOPointEventList * pLOPointEventList;
+    unsigned int               AsteroidIndex;
+    unsigned int               CoefOffset;
+    int                        AsteroidID;
+    int                        StarNumber;
+    int                        EarthFlag;
+    short                      Mv;
+    short                      ChebOrder;
+    unsigned char              Catalog;
+    double                     EphemerisUncertainty;
+    double                     ET_UT;
+    double                     BeginOccTime;
+    double                     EndOccTime;
+    double                     MaxDuration;
+    double                     StarRA;
+    double                     StarDec;
+    double                     MoonPhase;
+    double                     SunDist;
+    double                     MoonDist;
+    double                     Brightness;
+    double                     BrightDelta;
+    double                     Uncertainty;
 
   public:
 
-    LOEvent( const int aAsteroidID, const std::string & aAsteroidName,
-             const double aDiameter, const double aEphemerisUncertainty,
-             const double aObservationEpoch,
-             const double aM, const double aW, const double aO,
-             const double aI, const double aE, const double aA,
+    LOEvent( const LOEventData * apLOEventData, const unsigned int aAsteroidIndex,
+             const int aAsteroidID, const double aEphemerisUncertainty,
              const unsigned char aCatalog, const int aStarNumber,
-             const short aMv, const short aChebOrder,
-             const double * apcX, const double * apcY, const double * apcZ,
+             const short aMv, const short aChebOrder, const unsigned int aCoefOffset,
              const double aET_UT,
              const double aBeginOccTime, const double aEndOccTime,
              const int aEarthFlag, const double aMaxDuration,
              const double aStarRA, const double aStarDec,
              const double aMoonPhase, const double aSunDist,
              const double aMoonDist, const double aBrightness,
-             const double aBrightDelta, const double aUncertainty,
-             LOEvent * apNext );
+             const double aBrightDelta, const double aUncertainty );
+
+    LOEvent( const LOEvent & ) = delete;
+
+    LOEvent & operator=( const LOEvent & ) = delete;
 
-    virtual ~LOEvent( void );
+    LOEvent( LOEvent && aLOEvent ) noexcept;
 
-    LOEvent * GetNextEventPtr( void ) const
-      { return( pNext ); }
+    LOEvent & operator=( LOEvent && aLOEvent ) noexcept;
+
+    ~LOEvent( void );
+
+    /* Coefficients are not kept by LOEventData */
+    void DropCoefs( void );
 
     void AddPointEvent( const LOPointEvent * pLOPointEvent ) const;
 
     const LOPointEventItem * GetFirstPointEventItem( void ) const;
 
+    unsigned int GetAsteroidIndex( void ) const
+      { return( AsteroidIndex ); }
+
     int GetAsteroidID( void ) const
       { return( AsteroidID ); }
 
-    const std::string & GetAsteroidNamePtr( void ) const
-      { return( AsteroidName ); }
+    const std::string & GetAsteroidNamePtr( void ) const;
 
-    double GetDiameter( void ) const
-      { return( Diameter ); }
+    double GetDiameter( void ) const;
 
     double GetEphemerisUncertainty( void ) const
       { return( EphemerisUncertainty ); }
 
-    double GetObservationEpoch( void ) const
-      { return( ObservationEpoch ); }
+    double GetObservationEpoch( void ) const;
 
-    double GetM( void ) const
-      { return( M ); }
+    double GetM( void ) const;
 
-    double GetW( void ) const
-      { return( W ); }
+    double GetW( void ) const;
 
-    double GetO( void ) const
-      { return( O ); }
+    double GetO( void ) const;
 
-    double GetI( void ) const
-      { return( I ); }
+    double GetI( void ) const;
 
-    double GetE( void ) const
-      { return( E ); }
+    double GetE( void ) const;
 
-    double GetA( void ) const
-      { return( A ); }
+    double GetA( void ) const;
 
     unsigned char GetCatalog( void ) const
       { return( Catalog ); }
@@ -152,14 +149,15 @@ class LOEvent
     short GetChebOrder( void ) const
       { return( ChebOrder ); }
 
-    const double * GetcX( void ) const
-      { return( pcX ); }
+    /* Coefficients pointers are valid until next LOEventData :: CreateEvent,
+       GetcX returns 0 if LOEventData did not keep them, see SetKeepCoefs */
+    const double * GetcX( void ) const;
 
     const double * GetcY( void ) const
-      { return( pcY ); }
+      { return( GetcX() + ChebOrder + 1 ); }
 
     const double * GetcZ( void ) const
-      { return( pcZ ); }
+      { return( GetcX() + 2 * ( ChebOrder + 1 ) ); }
 
     double GetET_UT( void ) const
       { return( ET_UT ); }
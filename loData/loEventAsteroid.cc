@@ -0,0 +1,61 @@
+//------------------------------------------------------------------------------
+//
+// File:    loEventAsteroid.cc
+//
+// Purpose: Asteroid data shared by occultation events in LinOccult.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include "loEventAsteroid.h"
+
+namespace aps {
+
+  namespace apslinoccult {
+
+//======================= LOEventAsteroid ==========================
+
+LOEventAsteroid :: LOEventAsteroid( const int aAsteroidID, const std::string & aAsteroidName,
+                                    const double aDiameter, const double aObservationEpoch,
+                                    const double aM, const double aW, const double aO,
+                                    const double aI, const double aE, const double aA ) :
+                   AsteroidID( aAsteroidID ), AsteroidName( aAsteroidName ),
+                   Diameter( aDiameter ), ObservationEpoch( aObservationEpoch ),
+                   M( aM ), W( aW ), O( aO ), I( aI ), E( aE ), A( aA )
+{
+}
+
+LOEventAsteroid :: ~LOEventAsteroid( void )
+{
+}
+
+bool LOEventAsteroid :: IsEqual( const int aAsteroidID, const std::string & aAsteroidName,
+                                 const double aDiameter, const double aObservationEpoch,
+                                 const double aM, const double aW, const double aO,
+                                 const double aI, const double aE, const double aA ) const
+{
+  return( ( AsteroidID == aAsteroidID ) && ( AsteroidName == aAsteroidName ) &&
+          ( Diameter == aDiameter ) && ( ObservationEpoch == aObservationEpoch ) &&
+          ( M == aM ) && ( W == aW ) && ( O == aO ) && ( I == aI ) && ( E == aE ) && ( A == aA ) );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,102 @@
+//------------------------------------------------------------------------------
+//
+// File:    loEventAsteroid.h
+//
+// Purpose: Asteroid data shared by occultation events in LinOccult.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef LO_EVENT_ASTEROID_H
+#define LO_EVENT_ASTEROID_H
+
+#include <string>
+
+namespace aps {
+
+  namespace apslinoccult {
+
+//======================= LOEventAsteroid ==========================
+
+class LOEventAsteroid
+{
+  private:
+
+    int         AsteroidID;
+    std::string AsteroidName;
+    double      Diameter;
+    double      ObservationEpoch;
+    double      M;
+    double      W;
+    double      O;
+    double      I;
+    double      E;
+    double      A;
+
+  public:
+
+    LOEventAsteroid( const int aAsteroidID, const std::string & aAsteroidName,
+                     const double aDiameter, const double aObservationEpoch,
+                     const double aM, const double aW, const double aO,
+                     const double aI, const double aE, const double aA );
+
+    virtual ~LOEventAsteroid( void );
+
+    bool IsEqual( const int aAsteroidID, const std::string & aAsteroidName,
+                  const double aDiameter, const double aObservationEpoch,
+                  const double aM, const double aW, const double aO,
+                  const double aI, const double aE, const double aA ) const;
+
+    int GetAsteroidID( void ) const
+      { return( AsteroidID ); }
+
+    const std::string & GetAsteroidNamePtr( void ) const
+      { return( AsteroidName ); }
+
+    double GetDiameter( void ) const
+      { return( Diameter ); }
+
+    double GetObservationEpoch( void ) const
+      { return( ObservationEpoch ); }
+
+    double GetM( void ) const
+      { return( M ); }
+
+    double GetW( void ) const
+      { return( W ); }
+
+    double GetO( void ) const
+      { return( O ); }
+
+    double GetI( void ) const
+      { return( I ); }
+
+    double GetE( void ) const
+      { return( E ); }
+
+    double GetA( void ) const
+      { return( A ); }
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -8,6 +8,12 @@
 //
 // Initial version 0.1 28.12.2004
 //         version 0.2 07.02.2005 Event processing was added.
+//         version 0.3 19.10.2026 Date, asteroid and star indexes
+//         version 0.4 19.10.2026 Events in vector, shared asteroid table and coefficients pool
+//         version 0.5 19.10.2026 LOEventSink was added
+//         version 0.6 19.10.2026 Indexes keep event numbers, FindEvent uses star index
+//         version 0.7 19.10.2026 Coefficients can be dropped after the event sink
+//         version 0.8 19.10.2026 Point event lists are deleted by LOEvent
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -25,41 +31,108 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
+#include <utility>
+
 #include "loEventData.h"
-#include "loEvent.h"
+#include "loEventSink.h"
 
 namespace aps {
 
   namespace apslinoccult {
 
+static bool IfDateLess( const LOEvent & LOEvent1, const LOEvent & LOEvent2 )
+{
+  return( LOEvent1.GetBeginOccTime() < LOEvent2.GetBeginOccTime() );
+}
+
+static bool IfEventDateLess( const LOEvent & LOEvent1, const double Mjd )
+{
+  return( LOEvent1.GetBeginOccTime() < Mjd );
+}
+
+static bool IfDateEventLess( const double Mjd, const LOEvent & LOEvent1 )
+{
+  return( Mjd < LOEvent1.GetBeginOccTime() );
+}
+
+typedef std::pair<unsigned char,int> StarKey;
+
+// Index entries are event numbers, so they survive reallocation of Events
+
+class IfAsteroidLess
+{
+  private:
+
+    const std::vector<LOEvent> & Events;
+
+  public:
+
+    IfAsteroidLess( const std::vector<LOEvent> & aEvents ) : Events( aEvents ) {}
+
+    bool operator()( const unsigned int Number1, const unsigned int Number2 ) const
+      { return( Events[ Number1 ].GetAsteroidID() < Events[ Number2 ].GetAsteroidID() ); }
+
+    bool operator()( const unsigned int Number, const int AsteroidID ) const
+      { return( Events[ Number ].GetAsteroidID() < AsteroidID ); }
+
+    bool operator()( const int AsteroidID, const unsigned int Number ) const
+      { return( AsteroidID < Events[ Number ].GetAsteroidID() ); }
+};
+
+class IfStarLess
+{
+  private:
+
+    const std::vector<LOEvent> & Events;
+
+    StarKey GetKey( const unsigned int Number ) const
+      { return( StarKey( Events[ Number ].GetCatalog(), Events[ Number ].GetStarNumber() ) ); }
+
+  public:
+
+    IfStarLess( const std::vector<LOEvent> & aEvents ) : Events( aEvents ) {}
+
+    bool operator()( const unsigned int Number1, const unsigned int Number2 ) const
+      { return( GetKey( Number1 ) < GetKey( Number2 ) ); }
+
+    bool operator()( const unsigned int Number, const StarKey & Key ) const
+      { return( GetKey( Number ) < Key ); }
+
+    bool operator()( const StarKey & Key, const unsigned int Number ) const
+      { return( Key < GetKey( Number ) ); }
+};
+
 //======================= LOEventData ==========================
 
-LOEventData :: LOEventData( void ) : ppLOEventsArray( 0 ),
-                                     pFirstEvent( 0 ),
-                                     EventsNumber( 0 )
+LOEventData :: LOEventData( void ) : MaxOccDuration( 0.0 ), pEventSink( 0 ), IfKeepCoefs( 1 )
 {
 }
 
 LOEventData :: ~LOEventData( void )
 {
-  const LOEvent * pLOEvent;
-  const LOEvent * pLONextEvent;
+}
 
-  if( ppLOEventsArray ) {
-    for( unsigned int i = 0; i < EventsNumber; i++ ) {
-      delete ppLOEventsArray[ i ];
-    }
+unsigned int LOEventData :: AddEventAsteroid( const int AsteroidID, const std::string & AsteroidName,
+                                              const double Diameter, const double ObservationEpoch,
+                                              const double M, const double W, const double O,
+                                              const double I, const double E, const double A )
+{
+  std::map<int,unsigned int>::const_iterator p = LastEventAsteroids.find( AsteroidID );
 
-    delete ppLOEventsArray;
+  if( p != LastEventAsteroids.end() ) {
+    if( EventAsteroids[ p->second ].IsEqual( AsteroidID, AsteroidName, Diameter, ObservationEpoch,
+                                             M, W, O, I, E, A ) ) {
+      return( p->second );
+    }
   }
 
-  pLOEvent = pFirstEvent;
+  EventAsteroids.push_back( LOEventAsteroid( AsteroidID, AsteroidName, Diameter, ObservationEpoch,
+                                             M, W, O, I, E, A ) );
 
-  while( pLOEvent ) {
-    pLONextEvent = pLOEvent->GetNextEventPtr();
-    delete( pLOEvent );
-    pLOEvent = pLONextEvent;
-  }
+  LastEventAsteroids[ AsteroidID ] = EventAsteroids.size() - 1;
+
+  return( EventAsteroids.size() - 1 );
 }
 
 const LOEvent * LOEventData :: CreateEvent( const int AsteroidID, const std::string & AsteroidName,
@@ -78,25 +151,40 @@ const LOEvent * LOEventData :: CreateEvent( const int AsteroidID, const std::str
                                             const double Brightness, const double BrightDelta,
                                             const double Uncertainty )
 {
-  LOEvent * pLOEvent;
+  unsigned int AsteroidIndex;
+  unsigned int CoefOffset;
+
+  AsteroidIndex = AddEventAsteroid( AsteroidID, AsteroidName, Diameter, ObservationEpoch, M, W, O, I, E, A );
+
+  CoefOffset = Coefs.size();
+
+  Coefs.insert( Coefs.end(), pcX, pcX + ChebOrder + 1 );
+  Coefs.insert( Coefs.end(), pcY, pcY + ChebOrder + 1 );
+  Coefs.insert( Coefs.end(), pcZ, pcZ + ChebOrder + 1 );
 
-  pLOEvent = new LOEvent( AsteroidID, AsteroidName, Diameter, EphemerisUncertainty,
-                          ObservationEpoch, M, W, O, I, E, A,
-                          Catalog, StarNumber, Mv, ChebOrder,
-                          pcX, pcY, pcZ, ET_UT,
-                          BeginOccTime, EndOccTime, EarthFlag, MaxDuration,
-                          StarRA, StarDec, MoonPhase, SunDist, MoonDist,
-                          Brightness, BrightDelta, Uncertainty, pFirstEvent );
+  Events.push_back( LOEvent( this, AsteroidIndex, AsteroidID, EphemerisUncertainty,
+                             Catalog, StarNumber, Mv, ChebOrder, CoefOffset, ET_UT,
+                             BeginOccTime, EndOccTime, EarthFlag, MaxDuration,
+                             StarRA, StarDec, MoonPhase, SunDist, MoonDist,
+                             Brightness, BrightDelta, Uncertainty ) );
 
-  pFirstEvent = pLOEvent;
+  if( pEventSink ) {
+    pEventSink->PutEvent( &Events.back() );
+  }
+
+  if( !IfKeepCoefs ) { // Events are still needed by FindEvent
+    Coefs.resize( CoefOffset );
 
-  return( pLOEvent );
+    Events.back().DropCoefs();
+  }
+
+  return( &Events.back() );
 }
 
-LOEvent * LOEventData :: GetEventPtr( const unsigned int EventNumber ) const
+const LOEvent * LOEventData :: GetEventPtr( const unsigned int EventNumber ) const
 {
-  if( EventNumber < EventsNumber ) {
-    return( ppLOEventsArray[ EventNumber ] );
+  if( EventNumber < Events.size() ) {
+    return( &Events[ EventNumber ] );
   }
 
   return( 0 );
@@ -121,14 +209,24 @@ bool LOEventData :: IsEqual( const LOEvent * pLOEvent, const int AsteroidID, con
 const LOEvent * LOEventData :: FindEvent( const int AsteroidID, const unsigned char Catalog,
                                           const int StarNumber, const double DateTime ) const
 {
-  const LOEvent * pLOEvent = pFirstEvent;
+  unsigned int i = Events.size();
+  unsigned int First;
+  unsigned int Last;
+
+  while( i > StarIndex.size() ) { // the latest events first, they are not in the star index
+    i--;
 
-  while( pLOEvent ) {
-    if( IsEqual( pLOEvent, AsteroidID, Catalog, StarNumber, DateTime ) ) {
-      return( pLOEvent );
+    if( IsEqual( &Events[ i ], AsteroidID, Catalog, StarNumber, DateTime ) ) {
+      return( &Events[ i ] );
     }
+  }
+
+  FindEventsByStar( Catalog, StarNumber, First, Last );
 
-    pLOEvent = pLOEvent->GetNextEventPtr();
+  for( i = First; i < Last; i++ ) {
+    if( IsEqual( GetStarEventPtr( i ), AsteroidID, Catalog, StarNumber, DateTime ) ) {
+      return( GetStarEventPtr( i ) );
+    }
   }
 
   return( 0 );
@@ -136,48 +234,84 @@ const LOEvent * LOEventData :: FindEvent( const int AsteroidID, const unsigned c
 
 int LOEventData :: Rebuild( void )
 {
-  LOEvent      * pLOEvent;
-  unsigned int   CurrentNumber;
-  int            RetCode = 0;
+  SortByDate();
 
-  pLOEvent = pFirstEvent;
+  BuildIndexes();
 
-  while( pLOEvent ) {
-    EventsNumber++;
+  return( 0 );
+}
 
-    pLOEvent = pLOEvent->GetNextEventPtr();
-  }
+void LOEventData :: SortByDate( void )
+{
+  AsteroidIndex.clear();
+  StarIndex.clear();
 
-  if( EventsNumber ) {
-    ppLOEventsArray = new LOEvent * [ EventsNumber ];  
+  std::stable_sort( Events.begin(), Events.end(), IfDateLess );
+}
 
-    pLOEvent = pFirstEvent;
+void LOEventData :: BuildIndexes( void )
+{
+  unsigned int i;
 
-    CurrentNumber = 0;
+  MaxOccDuration = 0.0;
 
-    while( pLOEvent ) {
-      if( CurrentNumber < EventsNumber ) {
-        ppLOEventsArray[ CurrentNumber ] = pLOEvent;
+  AsteroidIndex.resize( Events.size() );
 
-        CurrentNumber++;
-      }
-      else {
-        RetCode = 1;
-        break;
-      }
+  for( i = 0; i < Events.size(); i++ ) {
+    MaxOccDuration = std::max( MaxOccDuration, Events[ i ].GetEndOccTime() - Events[ i ].GetBeginOccTime() );
 
-      pLOEvent = pLOEvent->GetNextEventPtr();
-    }
+    AsteroidIndex[ i ] = i;
+  }
 
-    pFirstEvent = 0;
+  StarIndex = AsteroidIndex;
+
+  std::stable_sort( AsteroidIndex.begin(), AsteroidIndex.end(), IfAsteroidLess( Events ) );
+
+  std::stable_sort( StarIndex.begin(), StarIndex.end(), IfStarLess( Events ) );
+}
+
+void LOEventData :: FindEventsByDate( const double MjdStart, const double MjdEnd,
+                                      unsigned int & First, unsigned int & Last ) const
+{
+  First = std::lower_bound( Events.begin(), Events.end(),
+                            MjdStart - MaxOccDuration, IfEventDateLess ) - Events.begin();
+  Last  = std::upper_bound( Events.begin() + First, Events.end(),
+                            MjdEnd, IfDateEventLess ) - Events.begin();
+}
+
+void LOEventData :: FindEventsByAsteroid( const int AsteroidID, unsigned int & First, unsigned int & Last ) const
+{
+  First = std::lower_bound( AsteroidIndex.begin(), AsteroidIndex.end(),
+                            AsteroidID, IfAsteroidLess( Events ) ) - AsteroidIndex.begin();
+  Last  = std::upper_bound( AsteroidIndex.begin() + First, AsteroidIndex.end(),
+                            AsteroidID, IfAsteroidLess( Events ) ) - AsteroidIndex.begin();
+}
+
+const LOEvent * LOEventData :: GetAsteroidEventPtr( const unsigned int Number ) const
+{
+  if( Number < AsteroidIndex.size() ) {
+    return( &Events[ AsteroidIndex[ Number ] ] );
   }
 
-  return( RetCode );
+  return( 0 );
 }
 
-void LOEventData :: SortByDate( void )
+void LOEventData :: FindEventsByStar( const unsigned char Catalog, const int StarNumber,
+                                      unsigned int & First, unsigned int & Last ) const
 {
+  const StarKey Key( Catalog, StarNumber );
+
+  First = std::lower_bound( StarIndex.begin(), StarIndex.end(), Key, IfStarLess( Events ) ) - StarIndex.begin();
+  Last  = std::upper_bound( StarIndex.begin() + First, StarIndex.end(), Key, IfStarLess( Events ) ) - StarIndex.begin();
+}
 
+const LOEvent * LOEventData :: GetStarEventPtr( const unsigned int Number ) const
+{
+  if( Number < StarIndex.size() ) {
+    return( &Events[ StarIndex[ Number ] ] );
+  }
+
+  return( 0 );
 }
 
 }}
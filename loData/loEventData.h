@@ -8,6 +8,12 @@
 //
 // Initial version 0.1 28.12.2004
 //         version 0.2 07.02.2005 Event processing was added.
+//         version 0.3 19.10.2026 Date, asteroid and star indexes
+//         version 0.4 19.10.2026 Events in vector, shared asteroid table and coefficients pool
+//         version 0.5 19.10.2026 LOEventSink was added
+//         version 0.6 19.10.2026 GetEventSinkPtr was added
+//         version 0.7 19.10.2026 Indexes keep event numbers, FindEvent uses star index
+//         version 0.8 19.10.2026 Coefficients can be dropped after the event sink
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -29,26 +35,48 @@
 #define LO_EVENT_DATA_H
 
 #include <string>
+#include <vector>
+#include <map>
+
+#include "loEvent.h"
+#include "loEventAsteroid.h"
 
 namespace aps {
 
   namespace apslinoccult {
 
-class LOEvent;
+class LOEventSink;
 
 //======================= LOEventData ==========================
 
 class LOEventData
 {
+  public:
+
+    static const unsigned int NO_COEFS = 0xFFFFFFFF; // CoefOffset of events without coefficients
+
   private:
 
-    LOEvent      ** ppLOEventsArray;
-    LOEvent       * pFirstEvent;
-    unsigned int    EventsNumber;
+    std::vector<LOEvent>          Events;
+    std::vector<LOEventAsteroid>  EventAsteroids;
+    std::map<int,unsigned int>    LastEventAsteroids;
+    std::vector<double>           Coefs;
+    std::vector<unsigned int>     AsteroidIndex;
+    std::vector<unsigned int>     StarIndex;
+    double                        MaxOccDuration;
+    LOEventSink                 * pEventSink;
+    int                           IfKeepCoefs;
 
     bool IsEqual( const LOEvent * pLOEvent, const int AsteroidID, const unsigned char Catalog,
                  const int StarNumber, const double DateTime ) const;
 
+    unsigned int AddEventAsteroid( const int AsteroidID, const std::string & AsteroidName,
+                                   const double Diameter, const double ObservationEpoch,
+                                   const double M, const double W, const double O,
+                                   const double I, const double E, const double A );
+
+    void BuildIndexes( void );
+
   public:
 
     LOEventData( void );
@@ -70,10 +98,32 @@ class LOEventData
                                  const double Brightness, const double BrightDelta,
                                  const double Uncertainty );
 
+    /* pEventSink gets events created after this call, 0 detaches it */
+    void SetEventSink( LOEventSink * apEventSink )
+      { pEventSink = apEventSink; }
+
+    LOEventSink * GetEventSinkPtr( void ) const
+      { return( pEventSink ); }
+
+    /* If 0, coefficients of events created after this call are given only to
+       the event sink and not kept, events without them can't be written or rerun */
+    void SetKeepCoefs( const int aIfKeepCoefs )
+      { IfKeepCoefs = aIfKeepCoefs; }
+
     unsigned int GetEventsNumber( void ) const
-      { return( EventsNumber ); }
+      { return( Events.size() ); }
+
+    /* Events pointers are valid until next CreateEvent */
+    const LOEvent * GetEventPtr( const unsigned int EventNumber ) const;
 
-    LOEvent * GetEventPtr( const unsigned int EventNumber ) const;
+    unsigned int GetEventAsteroidsNumber( void ) const
+      { return( EventAsteroids.size() ); }
+
+    const LOEventAsteroid * GetEventAsteroidPtr( const unsigned int AsteroidNumber ) const
+      { return( &EventAsteroids[ AsteroidNumber ] ); }
+
+    const double * GetCoefPtr( const unsigned int CoefOffset ) const
+      { return( &Coefs[ CoefOffset ] ); }
 
     const LOEvent * FindEvent( const int AsteroidID, const unsigned char Catalog,
                                const int StarNumber, const double DateTime ) const;
@@ -81,6 +131,28 @@ class LOEventData
     int Rebuild( void );
 
     void SortByDate( void );
+
+    /* Longest EndOccTime - BeginOccTime over all events, valid after Rebuild */
+    double GetMaxOccDuration( void ) const
+      { return( MaxOccDuration ); }
+
+    /* Events [ First, Last ) in date order which can intersect [ MjdStart, MjdEnd ] */
+    void FindEventsByDate( const double MjdStart, const double MjdEnd,
+                           unsigned int & First, unsigned int & Last ) const;
+
+    /* Asteroid and star indexes cover events up to the last Rebuild,
+       FindEvent scans later events linearly */
+
+    /* Events [ First, Last ) of asteroid index for AsteroidID */
+    void FindEventsByAsteroid( const int AsteroidID, unsigned int & First, unsigned int & Last ) const;
+
+    const LOEvent * GetAsteroidEventPtr( const unsigned int Number ) const;
+
+    /* Events [ First, Last ) of star index for Catalog and StarNumber */
+    void FindEventsByStar( const unsigned char Catalog, const int StarNumber,
+                           unsigned int & First, unsigned int & Last ) const;
+
+    const LOEvent * GetStarEventPtr( const unsigned int Number ) const;
 };
 
 }}
@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+//
+// File:    loEventSink.h
+//
+// Purpose: Receiver of occultation events created during calculation
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 LOCheckpoint, Checkpoint were added
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef LO_EVENT_SINK_H
+#define LO_EVENT_SINK_H
+
+namespace aps {
+
+  namespace apslinoccult {
+
+class LOEvent;
+
+//======================= LOCheckpoint ==========================
+
+/* Calculation state after the last fully processed asteroid */
+struct LOCheckpoint
+{
+  int    AsteroidIndex;         // Next asteroid in LOAstOrbData
+  int    AsteroidID;            // Last processed asteroid, 0 if there is no one
+  int    SQLNumber;             // Last MySQL event number
+  int    SiteRejectedEvents;
+  double ElongationCulledDays;
+};
+
+//======================= LOEventSink ==========================
+
+/* Gets every event created by LOEventData while it is attached */
+class LOEventSink
+{
+  public:
+
+    virtual ~LOEventSink( void ) {}
+
+    virtual void PutEvent( const LOEvent * pEvent ) = 0;
+
+    /* Events got so far belong to asteroids before Checkpoint.AsteroidIndex */
+    virtual void Checkpoint( const LOCheckpoint & Checkpoint ) = 0;
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -7,6 +7,7 @@
 // (c) 2005 Plekhanov Andrey
 //
 // Initial version 0.1 25.02.2005
+//         version 0.2 19.10.2026 Point events are allocated in pool
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -26,6 +27,7 @@
 
 #include "loPointEventData.h"
 #include "loPointEvent.h"
+#include "apspool.h"
 
 namespace aps {
 
@@ -33,25 +35,14 @@ namespace aps {
 
 //======================= LOPointEventData ==========================
 
-LOPointEventData :: LOPointEventData( void )
+LOPointEventData :: LOPointEventData( APSPool<LOPointEvent> * apLOPointEventPool ) :
+                    pLOPointEventPool( apLOPointEventPool )
 {
-  pLOPointEventList = new LOPointEventList();
 }
 
 LOPointEventData :: ~LOPointEventData( void )
 {
-  const LOPointEvent     * pLOPointEvent;
-  const LOPointEventItem * pLOPointEventItem;
-
-  pLOPointEventItem = pLOPointEventList->GetFirstPointEventItem();
-
-  while( pLOPointEventItem ) {
-    pLOPointEvent = pLOPointEventItem->GetPointEventPtr();
-    delete pLOPointEvent;
-    pLOPointEventItem = pLOPointEventItem->GetNextPointEventItemPtr();
-  }
-
-  delete pLOPointEventList;
+  /* point events are released with pool */
 }
 
 const LOPointEvent * LOPointEventData :: CreatePointEvent( const LOPos * pLOPos, const LOEvent * pLOEvent,
@@ -64,11 +55,10 @@ const LOPointEvent * LOPointEventData :: CreatePointEvent( const LOPos * pLOPos,
 {
   const LOPointEvent * pLOPointEvent;
 
-  pLOPointEvent = new LOPointEvent( pLOPos, pLOEvent, Distance, Mjdate,
-                                    StarElev, SunElev, MoonElev, MaxLongitude, MaxLatitude,
-                                    Probability, MaxProbability, Az, StarAz );
-
-  pLOPointEventList->AddPointEvent( pLOPointEvent );
+  pLOPointEvent = new ( pLOPointEventPool->Allocate() ) LOPointEvent( pLOPos, pLOEvent, Distance, Mjdate,
+                                                                      StarElev, SunElev, MoonElev,
+                                                                      MaxLongitude, MaxLatitude,
+                                                                      Probability, MaxProbability, Az, StarAz );
 
   return( pLOPointEvent );
 }
@@ -7,6 +7,7 @@
 // (c) 2005 Plekhanov Andrey
 //
 // Initial version 0.1 25.02.2005
+//         version 0.2 19.10.2026 Point events are allocated in pool
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -29,9 +30,14 @@
 
 namespace aps {
 
+  namespace apslib {
+    template<class T> class APSPool;
+  }
+
   namespace apslinoccult {
 
-class LOPointEventList;
+using apslib::APSPool;
+
 class LOPointEvent;
 class LOPos;
 class LOEvent;
@@ -42,11 +48,11 @@ class LOPointEventData
 {
   private:
 
-    LOPointEventList * pLOPointEventList;
+    APSPool<LOPointEvent> * pLOPointEventPool;
 
   public:
 
-    LOPointEventData( void );
+    LOPointEventData( APSPool<LOPointEvent> * apLOPointEventPool );
 
     virtual ~LOPointEventData( void );
 
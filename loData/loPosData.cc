@@ -7,6 +7,7 @@
 // (c) 2005 Plekhanov Andrey
 //
 // Initial version 0.1 17.02.2005
+//         version 0.2 19.10.2026 Rebuild can be called again
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -95,6 +96,11 @@ int LOPosData :: Rebuild( void )
   unsigned int   CurrentNumber;
   int            RetCode = 0;
 
+  // Already rebuilt
+  if( ppLOPosArray ) {
+    return( RetCode );
+  }
+
   pLOPos = pFirstPos;
 
   while( pLOPos ) {
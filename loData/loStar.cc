@@ -10,6 +10,7 @@
 //         version 0.2 10.06.2004 Mv has been added
 //         version 0.3 17.08.2005 Parallax was added
 //         version 0.4 11.01.2021 Gaia EDR3. SupNum was removed.
+//         version 0.5 19.10.2026 Destructor was removed, stars can be mapped
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -44,10 +45,6 @@ LOStar :: LOStar( const double aRA, const float apmRA,
 {
 }
 
-LOStar :: ~LOStar( void )
-{
-}
-
 /*void LOStar :: Print( void ) const
 {
   printf("RA = %lf pmRA = %e Dec = %lf pmDec = %e Parallax = %f Catalogue = %s StarNumber = %d Mv = %d\n",
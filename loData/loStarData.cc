@@ -10,6 +10,12 @@
 //         version 0.2 10.06.2004 Mv has been added
 //         version 0.3 13.01.2003 kdtree
 //         version 0.4 11.01.2021 Gaia EDR3. SupNum was removed.
+//         version 0.5 19.10.2026 Stars are allocated in pool
+//         version 0.6 19.10.2026 Star index file can be attached
+//         version 0.7 19.10.2026 FastFindStars uses kd-tree box query
+//         version 0.8 19.10.2026 Parallel kd-tree build
+//         version 0.9 19.10.2026 MaxMv in FastFindStars
+//         version 0.10 19.10.2026 Kd-tree subtrees are skipped by Mv
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -31,16 +37,75 @@
 #include <iostream>
 #include <sstream>
 
+#include <unistd.h>
+
 #include "loStarData.h"
 #include "loStar.h"
+#include "apspool.h"
+#include "apsimmapfile.h"
 
 namespace aps {
 
   namespace apslinoccult {
 
+//======================= LOStarBoxCollector ==========================
+
+// Receives star numbers from kd-tree box query. Tree keys are floats,
+// so the box is checked once more with double coordinates of star.
+class LOStarBoxCollector
+{
+  private:
+
+    const LOStarData * pLOStarData;
+    const LOStar    ** pLOStarsArray;
+    const unsigned int N_Max;
+    const double       RA1;
+    const double       Dec1;
+    const double       RA2;
+    const double       Dec2;
+    const short        MaxMv;
+
+  public:
+
+    unsigned int StarNumber;
+    bool         IfOverflow;
+
+    LOStarBoxCollector( const LOStarData * apLOStarData, const LOStar ** apLOStarsArray, const unsigned int aN_Max,
+                        const double aRA1, const double aDec1, const double aRA2, const double aDec2,
+                        const short aMaxMv ) :
+                        pLOStarData( apLOStarData ), pLOStarsArray( apLOStarsArray ), N_Max( aN_Max ),
+                        RA1( aRA1 ), Dec1( aDec1 ), RA2( aRA2 ), Dec2( aDec2 ), MaxMv( aMaxMv ),
+                        StarNumber( 0 ), IfOverflow( false )
+    {
+    }
+
+    bool operator()( const unsigned int Number )
+    {
+      const LOStar * pLOStar = pLOStarData->GetStarPtr( Number );
+
+      if( ( RA1 < pLOStar->GetRA() ) && ( RA2 > pLOStar->GetRA() ) &&
+          ( Dec1 < pLOStar->GetDec() ) && ( Dec2 > pLOStar->GetDec() ) &&
+          ( pLOStar->GetMv() <= MaxMv ) ) {
+        pLOStarsArray[ StarNumber ] = pLOStar;
+
+        StarNumber++;
+
+        if( StarNumber > N_Max ) {
+          IfOverflow = true;
+          return( false );
+        }
+      }
+
+      return( true );
+    }
+};
+
 //======================= LOStarData ==========================
 
-LOStarData :: LOStarData( const unsigned int aStarsNumber ) :
+LOStarData :: LOStarData( const unsigned int aStarsNumber, APSPool<LOStar> * apLOStarPool ) :
+                          pLOStarPool( apLOStarPool ),
+                          pMappedStars( 0 ),
+                          pIndexFile( 0 ),
                           StarsNumber( aStarsNumber ),
                           CurrentNumber( 0 )
 {
@@ -49,11 +114,13 @@ LOStarData :: LOStarData( const unsigned int aStarsNumber ) :
 
 LOStarData :: ~LOStarData( void )
 {
-  for( unsigned int i = 0; i < CurrentNumber; i++ ) {
-    delete ppLOStarsArray[ i ];
-  }
+  /* stars are released with pool */
 
-  delete ppLOStarsArray;
+  delete [] ppLOStarsArray;
+
+  if( pIndexFile ) {
+    delete pIndexFile;
+  }
 }
 
 const LOStar * LOStarData :: CreateStar( const double RA, const float pmRA,
@@ -65,7 +132,7 @@ const LOStar * LOStarData :: CreateStar( const double RA, const float pmRA,
   LOStar * pLOStar;
 
   if( CurrentNumber < StarsNumber ) {
-    pLOStar = new LOStar( RA, pmRA, Dec, pmDec, Parallax, Vrad, Epoch, Catalogue, StarNumber, Mv );
+    pLOStar = new ( pLOStarPool->Allocate() ) LOStar( RA, pmRA, Dec, pmDec, Parallax, Vrad, Epoch, Catalogue, StarNumber, Mv );
 
     ppLOStarsArray[ CurrentNumber ] = pLOStar;
 
@@ -81,7 +148,7 @@ const LOStar * LOStarData :: CreateStar( const double RA, const float pmRA,
 const LOStar * LOStarData :: GetStarPtr( const unsigned int StarNumber ) const
 {
   if( StarNumber < CurrentNumber ) {
-    return( ppLOStarsArray[ StarNumber ] );
+    return( pMappedStars ? pMappedStars + StarNumber : ppLOStarsArray[ StarNumber ] );
   }
 
   return( 0 );
@@ -105,67 +172,64 @@ const LOStar * LOStarData :: FindStar( const unsigned char Catalogue, const int
   return( 0 );
 }
 
-int LOStarData :: BuildKDTree( void )
+int LOStarData :: BuildKDTree( const int ThreadsNumber )
 {
   const LOStar * pLOStar;
+  int            Threads;
   int            RetCode = 0;
 
+  if( tree.is_built() ) { // Built already or mapped from star index file
+    return( RetCode );
+  }
+
+  tree.reserve( GetCurrentNumber() );
+
   for( unsigned int i = 0; i < GetCurrentNumber(); i++ ) {
     pLOStar = GetStarPtr( i );
 
     Vec2f p0 = Vec2f( pLOStar->GetRA(), pLOStar->GetDec() );
 
-    tree.insert( p0, pLOStar );
+    tree.insert( p0, i, pLOStar->GetMv() );
   }
 
-  tree.build();
+  Threads = ThreadsNumber > 0 ? ThreadsNumber : static_cast<int>( sysconf( _SC_NPROCESSORS_ONLN ) );
+
+  tree.build( Threads );
 
   return( RetCode );
 }
 
-int LOStarData :: FastFindStars( const LOStar ** pLOStarsArray, unsigned int & StarNumber,
-                                 const double RA1, const double Dec1,
-                                 const double RA2, const double Dec2 ) const
+void LOStarData :: AttachIndex( APSIMMapFile * apIndexFile, const LOStar * apMappedStars, const unsigned int aStarsNumber,
+                                const void * pNodes, const unsigned int NodesNumber )
 {
-  int                i;
-  double             range;
-  std::vector<Vec2f> keys;
-  std::vector<const LOStar*> vals;
-  const LOStar     * pLOStar;
-  int                N;
-  unsigned int       N_Max;
-  int                RetCode = 0;
-
-  N_Max = StarNumber;
-
-  Vec2f p0 = Vec2f( ( RA1 + RA2 ) / 2.0, ( Dec1 + Dec2 ) / 2.0 );
-
-  range = std::sqrt( ( RA1 - RA2 ) * ( RA1 - RA2 ) + ( Dec1 - Dec2 ) * ( Dec1 - Dec2 ) );
+  if( pIndexFile ) {
+    delete pIndexFile;
+  }
 
-  N = tree.in_sphere( p0, range, keys, vals );
+  pIndexFile    = apIndexFile;
+  pMappedStars  = apMappedStars;
+  StarsNumber   = aStarsNumber;
+  CurrentNumber = aStarsNumber;
 
-  StarNumber = 0;
+  tree.attach( pNodes, NodesNumber );
+}
 
-  for( i = 0; i < N; i++ ) {
-    pLOStar = vals[ i ];
+int LOStarData :: FastFindStars( const LOStar ** pLOStarsArray, unsigned int & StarNumber,
+                                 const double RA1, const double Dec1,
+                                 const double RA2, const double Dec2,
+                                 const short MaxMv ) const
+{
+  LOStarBoxCollector Collector( this, pLOStarsArray, StarNumber, RA1, Dec1, RA2, Dec2, MaxMv );
+  int                RetCode = 0;
 
-    if( RA1 < pLOStar->GetRA() ) {
-      if( RA2 > pLOStar->GetRA() ) {
-        if( Dec1 < pLOStar->GetDec() ) {
-          if( Dec2 > pLOStar->GetDec() ) {
-            pLOStarsArray[ StarNumber ] = pLOStar;
+  // Subtrees without stars up to MaxMv are not visited
+  tree.in_box( Vec2f( RA1, Dec1 ), Vec2f( RA2, Dec2 ), MaxMv, Collector );
 
-            StarNumber++;
+  StarNumber = Collector.StarNumber;
 
-            if( StarNumber > N_Max ) {
-              std::cout << "WARNING: LOStarData :: FastFindStars: too many stars." << std::endl;
-              RetCode = 1;
-              break;
-            }
-          }
-        }
-      }
-    }
+  if( Collector.IfOverflow ) {
+    std::cout << "WARNING: LOStarData :: FastFindStars: too many stars." << std::endl;
+    RetCode = 1;
   }
 
   return( RetCode );
@@ -10,6 +10,11 @@
 //         version 0.2 10.06.2004 Mv has been added
 //         version 0.3 13.01.2005 kdtree
 //         version 0.4 11.01.2021 Gaia EDR3. SupNum was removed.
+//         version 0.5 19.10.2026 Stars are allocated in pool
+//         version 0.6 19.10.2026 Star index file can be attached
+//         version 0.7 19.10.2026 Parallel kd-tree build
+//         version 0.8 19.10.2026 MaxMv in FastFindStars
+//         version 0.9 19.10.2026 Kd-tree subtrees are skipped by Mv
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -37,8 +42,16 @@
 
 namespace aps {
 
+  namespace apslib {
+    template<class T> class APSPool;
+    class APSIMMapFile;
+  }
+
   namespace apslinoccult {
 
+using apslib::APSPool;
+using apslib::APSIMMapFile;
+
 class LOStar;
 
 using namespace CGLA;
@@ -50,13 +63,18 @@ class LOStarData
   private:
 
     LOStar         ** ppLOStarsArray;
+    APSPool<LOStar> * pLOStarPool;
+    const LOStar    * pMappedStars;
+    APSIMMapFile    * pIndexFile;
     unsigned int      StarsNumber;
     unsigned int      CurrentNumber;
-    KDTree<Vec2f,const LOStar*> tree;
+    KDTree<Vec2f,unsigned int> tree; // values are star numbers, ranks are Mv
 
   public:
 
-    LOStarData( const unsigned int aStarsNumber );
+    static const short NO_MV_LIMIT = 32767;
+
+    LOStarData( const unsigned int aStarsNumber, APSPool<LOStar> * apLOStarPool );
 
     virtual ~LOStarData( void );
 
@@ -76,11 +94,27 @@ class LOStarData
 
     const LOStar * FindStar( const unsigned char Catalogue, const int StarNumber ) const;
 
-    int BuildKDTree( void );
+    int BuildKDTree( const int ThreadsNumber );
+
+    /* Uses stars and kd-tree nodes from mapped star index file, takes file ownership */
+    void AttachIndex( APSIMMapFile * apIndexFile, const LOStar * apMappedStars, const unsigned int aStarsNumber,
+                      const void * pNodes, const unsigned int NodesNumber );
+
+    const void * GetKDTreeNodesPtr( void ) const
+      { return( tree.get_node_data() ); }
+
+    unsigned int GetKDTreeNodesNumber( void ) const
+      { return( tree.get_node_count() ); }
+
+    static size_t GetKDTreeNodeSize( void )
+      { return( KDTree<Vec2f,unsigned int> :: get_node_size() ); }
 
+    /* Stars fainter than MaxMv (in 0.01 mag) are skipped, kd-tree subtrees
+       holding only such stars are not visited */
     int FastFindStars( const LOStar ** pLOStarsArray, unsigned int & StarNumber,
                        const double RA1, const double Dec1,
-                       const double RA2, const double Dec2 ) const;
+                       const double RA2, const double Dec2,
+                       const short MaxMv = NO_MV_LIMIT ) const;
 
     static std::string GetCatName( const unsigned char Catalogue );
 
@@ -7,6 +7,7 @@
 // (c) 2005 Plekhanov Andrey
 //
 // Initial version 0.1 09.01.2005
+//         version 0.2 19.10.2026 SetRecord was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -24,6 +25,9 @@
 //
 //------------------------------------------------------------------------------
 
+#include <cstring>
+
+#include "loEvent.h"
 #include "loAbsEventDataIO.h"
 
 namespace aps {
@@ -54,6 +58,39 @@ int LOAbsEventDataIO :: IfInInterval( const double MjdStart, const double MjdEnd
   return( 1 );
 }
 
+void LOAbsEventDataIO :: SetRecord( const LOEvent * pEvent, LOEventRecord & Record ) const
+{
+  std::memset( &Record, 0, sizeof( Record ) );
+
+  Record.AsteroidID           = pEvent->GetAsteroidID();
+  Record.Diameter             = pEvent->GetDiameter();
+  Record.EphemerisUncertainty = pEvent->GetEphemerisUncertainty();
+  Record.ObservationEpoch     = pEvent->GetObservationEpoch();
+  Record.M                    = pEvent->GetM();
+  Record.W                    = pEvent->GetW();
+  Record.O                    = pEvent->GetO();
+  Record.I                    = pEvent->GetI();
+  Record.E                    = pEvent->GetE();
+  Record.A                    = pEvent->GetA();
+  Record.Catalog              = pEvent->GetCatalog();
+  Record.StarNumber           = pEvent->GetStarNumber();
+  Record.Mv                   = pEvent->GetMv();
+  Record.ChebOrder            = pEvent->GetChebOrder();
+  Record.ET_UT                = pEvent->GetET_UT();
+  Record.BeginOccTime         = pEvent->GetBeginOccTime();
+  Record.EndOccTime           = pEvent->GetEndOccTime();
+  Record.EarthFlag            = pEvent->GetEarthFlag();
+  Record.MaxDuration          = pEvent->GetMaxDuration();
+  Record.StarRA               = pEvent->GetStarRA();
+  Record.StarDec              = pEvent->GetStarDec();
+  Record.MoonPhase            = pEvent->GetMoonPhase();
+  Record.SunDist              = pEvent->GetSunDist();
+  Record.MoonDist             = pEvent->GetMoonDist();
+  Record.Brightness           = pEvent->GetBrightness();
+  Record.BrightDelta          = pEvent->GetBrightDelta();
+  Record.Uncertainty          = pEvent->GetUncertainty();
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
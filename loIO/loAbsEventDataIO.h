@@ -8,6 +8,11 @@
 //
 // Initial version 0.1 09.01.2005
 //         version 0.2 10.02.2021 FILE_VERSION_1 2 -> 3
+//         version 0.3 19.10.2026 FILE_VERSION_2 with packed records and footer
+//         version 0.4 19.10.2026 FILE_VERSION_2 sections are aligned and sorted by date
+//         version 0.5 19.10.2026 FILE_VERSION_3 stream of event frames, SetRecord
+//         version 0.6 19.10.2026 LOCheckpointRecord was added
+//         version 0.7 19.10.2026 FILE_VERSION_2 4 -> 5 for aligned layout, FILE_VERSION_3 5 -> 6
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -28,6 +33,8 @@
 #ifndef LO_ABS_EVENT_DATA_IO_H
 #define LO_ABS_EVENT_DATA_IO_H
 
+#include <stdint.h>
+
 namespace aps {
 
   namespace apslinoccult {
@@ -35,6 +42,117 @@ namespace aps {
 typedef unsigned int DescriptorType;
 
 const int FILE_VERSION_1 = 3;
+const int FILE_VERSION_2 = 5;   /* 4 was FILE_VERSION_2 without alignment, it is not read */
+const int FILE_VERSION_3 = 6;
+
+const int CHECKPOINT_VERSION = 1;
+
+const int EVENT_FILE_ALIGNMENT        = 8;
+const int EVENT_FILE_SORTED_BY_DATE   = 0x01;
+const int EVENT_FILE_STREAM           = 0x02;
+
+/*
+  FILE_VERSION_2 layout ( every section starts at EVENT_FILE_ALIGNMENT boundary ):
+
+    Descriptor, program name length, program name, version
+    LOEventRecord    [ RecordsNumber ]  sorted by BeginOccTime if EVENT_FILE_SORTED_BY_DATE
+    double           [ CoefNumber ]     Chebyshev coefficients, X Y Z per event
+    char             [ NamesSize ]      asteroid names string table
+    LOEventFileFooter
+
+  FILE_VERSION_3 layout is written while events are calculated:
+
+    Descriptor, program name length, program name, version
+    Frames, one per event in creation order:
+      LOEventFrame
+      LOEventRecord                     CoefOffset and NameOffset are 0
+      double           [ 3 * ( ChebOrder + 1 ) ]
+      char             [ NameLength ]   padded to EVENT_FILE_ALIGNMENT
+    LOEventFileFooter                   EVENT_FILE_STREAM, CoefOffset is the end of frames
+
+  File without footer is read up to the last frame with valid checksum.
+
+  Checkpoint file of the stream is one LOCheckpointRecord.
+*/
+
+#pragma pack(1)
+
+struct LOEventRecord
+{
+  double        Diameter;
+  double        EphemerisUncertainty;
+  double        ObservationEpoch;
+  double        M;
+  double        W;
+  double        O;
+  double        I;
+  double        E;
+  double        A;
+  double        ET_UT;
+  double        BeginOccTime;
+  double        EndOccTime;
+  double        MaxDuration;
+  double        StarRA;
+  double        StarDec;
+  double        MoonPhase;
+  double        SunDist;
+  double        MoonDist;
+  double        Brightness;
+  double        BrightDelta;
+  double        Uncertainty;
+  int64_t       CoefOffset;     /* index of the first cX coefficient */
+  int           AsteroidID;
+  int           NameOffset;     /* offset in the names string table */
+  int           NameLength;
+  int           StarNumber;
+  int           EarthFlag;
+  short         Mv;
+  short         ChebOrder;
+  unsigned char Catalog;
+  unsigned char Reserved[ 7 ];  /* keeps records size multiple of EVENT_FILE_ALIGNMENT */
+};
+
+struct LOEventFrame
+{
+  DescriptorType Descriptor;
+  int            Size;            /* bytes after the frame header */
+  uint64_t       Checksum;        /* APSHash of these bytes */
+};
+
+struct LOEventFileFooter
+{
+  int64_t        RecordsOffset;
+  int64_t        CoefOffset;
+  int64_t        NamesOffset;
+  int64_t        CoefNumber;
+  int64_t        NamesSize;
+  double         MaxOccDuration;  /* longest EndOccTime - BeginOccTime */
+  int            RecordsNumber;
+  int            RecordSize;
+  int            Flags;
+  DescriptorType Descriptor;
+};
+
+struct LOCheckpointRecord
+{
+  DescriptorType Descriptor;
+  int            Version;               /* CHECKPOINT_VERSION */
+  int64_t        RecordsOffset;         /* first frame of the stream */
+  int64_t        StreamOffset;          /* end of frames of the processed asteroids */
+  double         MaxOccDuration;
+  double         ElongationCulledDays;
+  int            RecordsNumber;
+  int            AsteroidIndex;
+  int            AsteroidID;
+  int            SQLNumber;
+  int            SiteRejectedEvents;
+  int            Reserved;
+  uint64_t       Checksum;              /* APSHash of the fields above */
+};
+
+#pragma pack()
+
+class LOEvent;
 
 //======================= LOAbsEventDataIO ==========================
 
@@ -47,6 +165,9 @@ class LOAbsEventDataIO
     int IfInInterval( const double MjdStart, const double MjdEnd,
                       const double BeginOccTime, const double EndOccTime ) const;
 
+    /* all fields except CoefOffset, NameOffset and NameLength */
+    void SetRecord( const LOEvent * pEvent, LOEventRecord & Record ) const;
+
   public:
 
     LOAbsEventDataIO( void );
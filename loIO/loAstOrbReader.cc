@@ -14,6 +14,8 @@
 // version 0.5 15.02.2005 Slope was added
 // version 0.6 05.03.2005 StartAsteroidNumber, EndAsteroidNumber were added
 // version 0.7 17.04.2005 Updates database was added
+// version 0.8 19.10.2026 Mapped file parallel reader was added
+// version 0.9 19.10.2026 Astorb snapshot was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -35,12 +37,22 @@
 #include <iostream>
 #include <iomanip>
 #include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/stat.h>
 
 #include "apsmathconst.h"
 #include "apsangle.h"
 #include "apstime.h"
+#include "apsimmapfile.h"
+#include "apshash.h"
 
 #include "loAstOrbReader.h"
+#include "loAstOrbSnapshot.h"
 #include "loData.h"
 #include "loAstOrbData.h"
 #include "loUpdateData.h"
@@ -54,8 +66,116 @@ namespace aps {
 
 const int SHOW_AST_NUMBER = 1000;
 
+/* Smallest number of lines given to one chunk worker */
+const int MIN_CHUNK_LINES = 4096;
+
+/* Longest numeric column of astorb.dat */
+const unsigned int MAX_FIELD_LENGTH = 16;
+
+enum {
+  AST_ORB_FLAG_ASTEROID_ID                 = 0x00001,
+  AST_ORB_FLAG_ASTEROID_NAME               = 0x00002,
+  AST_ORB_FLAG_BRIGTENES                   = 0x00004,
+  AST_ORB_FLAG_SLOPE                       = 0x00008,
+  AST_ORB_FLAG_DIAMETER                    = 0x00010,
+  AST_ORB_FLAG_OBSERVATION_YEAR            = 0x00020,
+  AST_ORB_FLAG_OBSERVATION_MONTH           = 0x00040,
+  AST_ORB_FLAG_OBSERVATION_DAY             = 0x00080,
+  AST_ORB_FLAG_M                           = 0x00100,
+  AST_ORB_FLAG_W                           = 0x00200,
+  AST_ORB_FLAG_O                           = 0x00400,
+  AST_ORB_FLAG_I                           = 0x00800,
+  AST_ORB_FLAG_E                           = 0x01000,
+  AST_ORB_FLAG_A                           = 0x02000,
+  AST_ORB_FLAG_EPHEMERIS_UNCERTAINTY       = 0x04000,
+  AST_ORB_FLAG_NO_DIAMETER_AND_BRIGTHNESS  = 0x08000,
+  AST_ORB_FLAG_NOT_ENOUGH_DATA             = 0x10000
+};
+
+/* Field warnings in the order of ReadOneAsteroid */
+const struct {
+  unsigned int Flag;
+  int          MsgNumber;
+} AST_ORB_FLAG_MESSAGES[] = {
+  { AST_ORB_FLAG_ASTEROID_ID,           LO_AST_ORB_READER_ASTEROID_ID },
+  { AST_ORB_FLAG_ASTEROID_NAME,         LO_AST_ORB_READER_ASTEROID_NAME },
+  { AST_ORB_FLAG_BRIGTENES,             LO_AST_ORB_READER_BRIGTENES },
+  { AST_ORB_FLAG_SLOPE,                 LO_AST_ORB_READER_SLOPE },
+  { AST_ORB_FLAG_DIAMETER,              LO_AST_ORB_READER_DIAMETER },
+  { AST_ORB_FLAG_OBSERVATION_YEAR,      LO_AST_ORB_READER_OBSERVATION_YEAR },
+  { AST_ORB_FLAG_OBSERVATION_MONTH,     LO_AST_ORB_READER_OBSERVATION_MONTH },
+  { AST_ORB_FLAG_OBSERVATION_DAY,       LO_AST_ORB_READER_OBSERVATION_DAY },
+  { AST_ORB_FLAG_M,                     LO_AST_ORB_READER_M },
+  { AST_ORB_FLAG_W,                     LO_AST_ORB_READER_W },
+  { AST_ORB_FLAG_O,                     LO_AST_ORB_READER_O },
+  { AST_ORB_FLAG_I,                     LO_AST_ORB_READER_I },
+  { AST_ORB_FLAG_E,                     LO_AST_ORB_READER_E },
+  { AST_ORB_FLAG_A,                     LO_AST_ORB_READER_A },
+  { AST_ORB_FLAG_EPHEMERIS_UNCERTAINTY, LO_AST_ORB_READER_EPHEMERIS_UNCERTAINTY }
+};
+
+const int AST_ORB_FLAG_MESSAGES_NUMBER = sizeof( AST_ORB_FLAG_MESSAGES ) / sizeof( AST_ORB_FLAG_MESSAGES[ 0 ] );
+
+/* Same result as istringstream >> int over the column, without a copy */
+static bool ParseInteger( const char * pLine, const size_t LineLength,
+                          const unsigned int Offset, const unsigned int Length, int & Value )
+{
+  const char * p;
+  const char * pEnd;
+  bool         IfNegative = false;
+  int          Result     = 0;
+
+  if( Offset + Length > LineLength ) {
+    return( false );
+  }
+
+  p    = pLine + Offset;
+  pEnd = p + Length;
+
+  while( ( p < pEnd ) && ( ( *p == ' ' ) || ( ( *p >= '\t' ) && ( *p <= '\r' ) ) ) ) {
+    p++;
+  }
+
+  if( ( p < pEnd ) && ( ( *p == '+' ) || ( *p == '-' ) ) ) {
+    IfNegative = ( *p == '-' );
+    p++;
+  }
+
+  if( ( p >= pEnd ) || ( *p < '0' ) || ( *p > '9' ) ) {
+    return( false );
+  }
+
+  while( ( p < pEnd ) && ( *p >= '0' ) && ( *p <= '9' ) ) {
+    Result = Result * 10 + ( *p - '0' );
+    p++;
+  }
+
+  Value = IfNegative ? -Result : Result;
+
+  return( true );
+}
+
+/* Same result as istringstream >> double over the column, stack buffer only */
+static bool ParseDouble( const char * pLine, const size_t LineLength,
+                         const unsigned int Offset, const unsigned int Length, double & Value )
+{
+  char   Buffer[ MAX_FIELD_LENGTH + 1 ];
+  char * pEnd;
+
+  if( ( Offset + Length > LineLength ) || ( Length > MAX_FIELD_LENGTH ) ) {
+    return( false );
+  }
+
+  memcpy( Buffer, pLine + Offset, Length );
+  Buffer[ Length ] = '\0';
+
+  Value = strtod( Buffer, &pEnd );
+
+  return( pEnd != Buffer );
+}
+
 LOAstOrbReader :: LOAstOrbReader( LOAstOrbReadSubModule * pLOAstOrbReadSubModule, const std::string & AstOrbFilePath ) :
-                  AstOrbReader( AstOrbFilePath ), UpdatesNumber( 0 )
+                  AstOrbReader( AstOrbFilePath ), UpdatesNumber( 0 ), SnapshotMessage( 0 )
 {
   pModule = new LOModuleAstOrbReader( pLOAstOrbReadSubModule );
 }
@@ -706,6 +826,554 @@ int LOAstOrbReader :: ReadOneAsteroid( LOAstOrbData * pLOAstOrbData, LOUpdateDat
   return( RetCode );
 }
 
+void LOAstOrbReader :: ParseHead( const char * pLine, const size_t LineLength, LOAstOrbRecord & Record )
+{
+  bool IfBrigteness;
+
+  Record.Flags = 0;
+
+  if( !ParseInteger( pLine, LineLength, apsastroio::ASTER_NUMBER_OFFSET, apsastroio::ASTER_NUMBER_LENGTH, Record.AsteroidID ) ) {
+    Record.AsteroidID = 0;
+    Record.Flags |= AST_ORB_FLAG_ASTEROID_ID;
+  }
+
+  if( apsastroio::ASTER_NAME_OFFSET + apsastroio::ASTER_NAME_LENGTH <= LineLength ) {
+    memcpy( Record.AsteroidName, pLine + apsastroio::ASTER_NAME_OFFSET, apsastroio::ASTER_NAME_LENGTH );
+    Record.AsteroidName[ apsastroio::ASTER_NAME_LENGTH ] = '\0';
+  }
+  else {
+    strcpy( Record.AsteroidName, "NoName" );
+    Record.Flags |= AST_ORB_FLAG_ASTEROID_NAME;
+  }
+
+  IfBrigteness = ParseDouble( pLine, LineLength, apsastroio::ASTER_BRIGHTNESS_OFFSET, apsastroio::ASTER_BRIGHTNESS_LENGTH, Record.Brightness );
+
+  if( !IfBrigteness ) {
+    Record.Brightness = 0.0;
+    Record.Flags |= AST_ORB_FLAG_BRIGTENES;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_SLOPE_OFFSET, apsastroio::ASTER_SLOPE_LENGTH, Record.Slope ) ) {
+    Record.Slope = 0.0;
+    Record.Flags |= AST_ORB_FLAG_SLOPE;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_DIAM_OFFSET, apsastroio::ASTER_DIAM_LENGTH, Record.Diameter ) ) {
+    Record.Flags |= AST_ORB_FLAG_DIAMETER;
+
+    if( IfBrigteness ) {
+      Record.Diameter = pow( 10.0, 3.52 - 0.2 * Record.Brightness );
+    }
+    else {
+      Record.Diameter = 0.0;
+      Record.Flags |= AST_ORB_FLAG_NO_DIAMETER_AND_BRIGTHNESS;
+    }
+  }
+}
+
+void LOAstOrbReader :: ParseElements( const char * pLine, const size_t LineLength, LOAstOrbRecord & Record )
+{
+  int ObservationYear;
+  int ObservationMonth;
+  int ObservationDay;
+
+  if( !ParseInteger( pLine, LineLength, apsastroio::ASTER_OBS_YEAR_OFFSET, apsastroio::ASTER_OBS_YEAR_LENGTH, ObservationYear ) ) {
+    Record.Flags |= AST_ORB_FLAG_OBSERVATION_YEAR | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseInteger( pLine, LineLength, apsastroio::ASTER_OBS_MONTH_OFFSET, apsastroio::ASTER_OBS_MONTH_LENGTH, ObservationMonth ) ) {
+    Record.Flags |= AST_ORB_FLAG_OBSERVATION_MONTH | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseInteger( pLine, LineLength, apsastroio::ASTER_OBS_DAY_OFFSET, apsastroio::ASTER_OBS_DAY_LENGTH, ObservationDay ) ) {
+    Record.Flags |= AST_ORB_FLAG_OBSERVATION_DAY | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_ORBIT_M_OFFSET, apsastroio::ASTER_ORBIT_M_LENGTH, Record.M ) ) {
+    Record.M = 0.0;
+    Record.Flags |= AST_ORB_FLAG_M | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_ORBIT_W_OFFSET, apsastroio::ASTER_ORBIT_W_LENGTH, Record.W ) ) {
+    Record.W = 0.0;
+    Record.Flags |= AST_ORB_FLAG_W | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_ORBIT_O_OFFSET, apsastroio::ASTER_ORBIT_O_LENGTH, Record.O ) ) {
+    Record.O = 0.0;
+    Record.Flags |= AST_ORB_FLAG_O | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_ORBIT_I_OFFSET, apsastroio::ASTER_ORBIT_I_LENGTH, Record.I ) ) {
+    Record.I = 0.0;
+    Record.Flags |= AST_ORB_FLAG_I | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_ORBIT_E_OFFSET, apsastroio::ASTER_ORBIT_E_LENGTH, Record.E ) ) {
+    Record.E = 0.0;
+    Record.Flags |= AST_ORB_FLAG_E | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_ORBIT_A_OFFSET, apsastroio::ASTER_ORBIT_A_LENGTH, Record.A ) ) {
+    Record.A = 0.0;
+    Record.Flags |= AST_ORB_FLAG_A | AST_ORB_FLAG_NOT_ENOUGH_DATA;
+  }
+
+  if( !ParseDouble( pLine, LineLength, apsastroio::ASTER_UNCERT_OFFSET, apsastroio::ASTER_UNCERT_LENGTH, Record.EphemerisUncertainty ) ) {
+    Record.EphemerisUncertainty = 0.0;
+    Record.Flags |= AST_ORB_FLAG_EPHEMERIS_UNCERTAINTY;
+  }
+
+  if( !( Record.Flags & AST_ORB_FLAG_NOT_ENOUGH_DATA ) ) {
+    Record.ObservationEpoch = apsastroalg::Mjd( ObservationYear, ObservationMonth, ObservationDay );
+  }
+  else {
+    Record.ObservationEpoch = 0.0;
+  }
+}
+
+bool LOAstOrbReader :: IfDiameterInLimits( const LOAstOrbFilter * pFilter, const LOAstOrbRecord & Record )
+{
+  // Same test as LOCalc::IfAsteroid
+  return( ( Record.Diameter >= pFilter->MinDiameter ) && ( Record.Diameter <= pFilter->MaxDiameter ) );
+}
+
+bool LOAstOrbReader :: FinishRecord( const LOAstOrbFilter * pFilter, LOAstOrbRecord & Record, int & UpdatesNumber )
+{
+  const LOUpdate * pLOUpdate;
+  double           TmpEU;
+
+  if( Record.Flags & AST_ORB_FLAG_NOT_ENOUGH_DATA ) {
+    return( true ); // Kept for warnings
+  }
+
+  if( Record.AsteroidID ) {
+    pLOUpdate = pFilter->pLOUpdateData->FindUpdate( Record.AsteroidID, Record.ObservationEpoch - pFilter->UpdatesExpirePeriod );
+
+    if( pLOUpdate ) {
+      Record.ObservationEpoch = pLOUpdate->GetObservationEpoch();
+      Record.M                = pLOUpdate->GetM();
+      Record.W                = pLOUpdate->GetW();
+      Record.O                = pLOUpdate->GetO();
+      Record.I                = pLOUpdate->GetI();
+      Record.E                = pLOUpdate->GetE();
+      Record.A                = pLOUpdate->GetA();
+
+      TmpEU = pLOUpdate->GetMajor();
+
+      if( TmpEU < pLOUpdate->GetMinor() ) {
+        TmpEU = pLOUpdate->GetMinor();
+      }
+
+      if( TmpEU != 0.0 ) {
+        Record.EphemerisUncertainty = TmpEU;
+      }
+
+      UpdatesNumber++;
+    }
+  }
+
+  if( pFilter->IfOneAsteroid ) {
+    if( ( pFilter->IfOneAsteroid == Record.AsteroidID ) || pFilter->IfOverrideAll ) {
+      Record.ObservationEpoch = pFilter->ObservationEpoch;
+      Record.M                = pFilter->M;
+      Record.W                = pFilter->W;
+      Record.O                = pFilter->O;
+      Record.I                = pFilter->I;
+      Record.E                = pFilter->E;
+      Record.A                = pFilter->A;
+    }
+  }
+
+  // Same test as LOCalc::IfAsteroid
+  return( ( Record.A >= pFilter->MinA ) && ( Record.A <= pFilter->MaxA ) );
+}
+
+void LOAstOrbReader :: ParseChunk( LOAstOrbChunk * pChunk )
+{
+  const LOAstOrbFilter * pFilter = pChunk->pFilter;
+  const char           * pLine;
+  const char           * pNext;
+  size_t                 LineLength;
+  LOAstOrbRecord         Record;
+
+  pChunk->LinesNumber   = 0;
+  pChunk->SkippedNumber = 0;
+  pChunk->UpdatesNumber = 0;
+
+  for( pLine = pChunk->pBegin; pLine < pChunk->pEnd; pLine = pNext ) {
+    pNext = static_cast<const char *>( memchr( pLine, '\n', pChunk->pEnd - pLine ) );
+
+    if( pNext ) {
+      LineLength = pNext - pLine;
+      pNext++;
+    }
+    else {
+      LineLength = pChunk->pEnd - pLine;
+      pNext      = pChunk->pEnd;
+    }
+
+    pChunk->LinesNumber++;
+
+    Record.Count = pChunk->LinesNumber;
+
+    ParseHead( pLine, LineLength, Record );
+
+    if( pFilter ) {
+      // The rest of the line is not parsed for skipped asteroids
+      if( !IfDiameterInLimits( pFilter, Record ) ) {
+        pChunk->SkippedNumber++;
+        continue;
+      }
+
+      ParseElements( pLine, LineLength, Record );
+
+      if( !FinishRecord( pFilter, Record, pChunk->UpdatesNumber ) ) {
+        pChunk->SkippedNumber++;
+        continue;
+      }
+    }
+    else {
+      ParseElements( pLine, LineLength, Record );
+    }
+
+    pChunk->Records.push_back( Record );
+  }
+}
+
+void * LOAstOrbReader :: ParseChunkThread( void * pArg )
+{
+  ParseChunk( static_cast<LOAstOrbChunk *>( pArg ) );
+
+  return( 0 );
+}
+
+void LOAstOrbReader :: ShowProgress( int & ShownCount, const int Count ) const
+{
+  while( ShownCount + SHOW_AST_NUMBER <= Count ) {
+    ShownCount += SHOW_AST_NUMBER;
+
+    pModule->StrMessage( LO_AST_ORB_READER_PROGRESS );
+  }
+}
+
+int LOAstOrbReader :: AddAsteroid( LOAstOrbData * pLOAstOrbData, const LOAstOrbRecord & Record, int & ShownCount )
+{
+  int i;
+  int RetCode = 0;
+
+  for( i = 0; i < AST_ORB_FLAG_MESSAGES_NUMBER; i++ ) {
+    if( Record.Flags & AST_ORB_FLAG_MESSAGES[ i ].Flag ) {
+      std::ostringstream Msg;
+      Msg << "Line " << Record.Count + 1 << std::endl;
+      pModule->WarningMessage( AST_ORB_FLAG_MESSAGES[ i ].MsgNumber, Msg.str() );
+    }
+  }
+
+  ShowProgress( ShownCount, Record.Count );
+
+  if( !( Record.Flags & AST_ORB_FLAG_NOT_ENOUGH_DATA ) ) {
+    if( Record.Flags & AST_ORB_FLAG_NO_DIAMETER_AND_BRIGTHNESS ) {
+      pModule->WarningMessage( LO_AST_ORB_READER_NO_DIAMETER_AND_BRIGTHNESS );
+    }
+
+    if( !pLOAstOrbData->CreateAsteroid( Record.AsteroidID, Record.AsteroidName, Record.ObservationEpoch,
+                         Record.M * apsmathlib::Rad, Record.W * apsmathlib::Rad,
+                         Record.O * apsmathlib::Rad, Record.I * apsmathlib::Rad, Record.E, Record.A, Record.Diameter,
+                         Record.Brightness, Record.Slope, apsmathlib::Rad * apsmathlib::Ddd( 0, 0, Record.EphemerisUncertainty ) ) ) {
+      pModule->WarningMessage( LO_AST_ORB_READER_TOO_MANY_ASTEROIDS );
+      RetCode = 2;
+    }
+  }
+  else {
+    pModule->WarningMessage( LO_AST_ORB_READER_NOT_ENOUGH_DATA );
+    RetCode = 1;
+  }
+
+  return( RetCode );
+}
+
+void LOAstOrbReader :: ParseChunks( const char * pBegin, const char * pEnd, const LOAstOrbFilter * pFilter,
+                                    std::vector<LOAstOrbChunk> & Chunks ) const
+{
+  const char * pChunkEnd;
+  int          ThreadsNumber;
+  int          ChunksNumber;
+  int          i;
+
+  ThreadsNumber = pModule->GetAstOrbThreadsNumber();
+
+  if( ThreadsNumber <= 0 ) {
+    ThreadsNumber = static_cast<int>( sysconf( _SC_NPROCESSORS_ONLN ) );
+  }
+
+  ChunksNumber = static_cast<int>( ( pEnd - pBegin ) / GetRecordLength() ) / MIN_CHUNK_LINES + 1;
+
+  if( ChunksNumber > ThreadsNumber ) {
+    ChunksNumber = ThreadsNumber;
+  }
+
+  if( ChunksNumber < 1 ) {
+    ChunksNumber = 1;
+  }
+
+  Chunks.resize( ChunksNumber );
+
+  std::vector<pthread_t> Threads( ChunksNumber );
+  std::vector<bool>      IfThreads( ChunksNumber, false );
+
+  // Chunk bounds are moved forward to the next line start
+  for( i = 0; i < ChunksNumber; i++ ) {
+    Chunks[ i ].pBegin  = i ? Chunks[ i - 1 ].pEnd : pBegin;
+    Chunks[ i ].pFilter = pFilter;
+
+    if( i < ChunksNumber - 1 ) {
+      pChunkEnd = pBegin + ( pEnd - pBegin ) * ( i + 1 ) / ChunksNumber;
+
+      if( pChunkEnd <= Chunks[ i ].pBegin ) {
+        pChunkEnd = Chunks[ i ].pBegin;
+      }
+      else {
+        pChunkEnd = static_cast<const char *>( memchr( pChunkEnd - 1, '\n', pEnd - pChunkEnd + 1 ) );
+        pChunkEnd = pChunkEnd ? pChunkEnd + 1 : pEnd;
+      }
+
+      Chunks[ i ].pEnd = pChunkEnd;
+    }
+    else {
+      Chunks[ i ].pEnd = pEnd;
+    }
+
+    Chunks[ i ].Records.reserve( ( Chunks[ i ].pEnd - Chunks[ i ].pBegin ) / GetRecordLength() + 1 );
+  }
+
+  for( i = 1; i < ChunksNumber; i++ ) {
+    if( !pthread_create( &Threads[ i ], 0, ParseChunkThread, &Chunks[ i ] ) ) {
+      IfThreads[ i ] = true;
+    }
+    else {
+      pModule->WarningMessage( LO_AST_ORB_READER_THREAD );
+    }
+  }
+
+  for( i = 0; i < ChunksNumber; i++ ) {
+    if( IfThreads[ i ] ) {
+      pthread_join( Threads[ i ], 0 );
+    }
+    else {
+      ParseChunk( &Chunks[ i ] );
+    }
+  }
+}
+
+void LOAstOrbReader :: MakeSnapshot( std::vector<LOAstOrbChunk> & Chunks,
+                                     std::vector<LOAstOrbSnapshotRecord> & Records, std::string & Names ) const
+{
+  LOAstOrbSnapshotRecord Record;
+  unsigned int           i;
+  unsigned int           j;
+
+  for( i = 0; i < Chunks.size(); i++ ) {
+    for( j = 0; j < Chunks[ i ].Records.size(); j++ ) {
+      const LOAstOrbRecord & Source = Chunks[ i ].Records[ j ];
+
+      Record.Brightness           = Source.Brightness;
+      Record.Slope                = Source.Slope;
+      Record.Diameter             = Source.Diameter;
+      Record.ObservationEpoch     = Source.ObservationEpoch;
+      Record.M                    = Source.M;
+      Record.W                    = Source.W;
+      Record.O                    = Source.O;
+      Record.I                    = Source.I;
+      Record.E                    = Source.E;
+      Record.A                    = Source.A;
+      Record.EphemerisUncertainty = Source.EphemerisUncertainty;
+      Record.AsteroidID           = Source.AsteroidID;
+      Record.Flags                = Source.Flags;
+      Record.NameOffset           = Names.length();
+      Record.NameLength           = strlen( Source.AsteroidName );
+      Record.ElementsHash         = LOAstOrbSnapshot :: GetElementsHash( Record );
+
+      Names.append( Source.AsteroidName, Record.NameLength );
+
+      Records.push_back( Record );
+    }
+
+    std::vector<LOAstOrbRecord>().swap( Chunks[ i ].Records );
+  }
+}
+
+void LOAstOrbReader :: AddSnapshotAsteroids( LOAstOrbData * pLOAstOrbData, const LOAstOrbFilter * pFilter,
+                                             const LOAstOrbSnapshotRecord * pRecords, const char * pNames,
+                                             const int RecordsNumber,
+                                             const int StartAsteroidNumber, const int EndAsteroidNumber,
+                                             int & Count, int & SkippedNumber )
+{
+  LOAstOrbRecord Record;
+  int            Last;
+  int            ShownCount = 0;
+  int            NameLength;
+  int            i;
+
+  Last = std::min( EndAsteroidNumber, RecordsNumber );
+
+  Count = 0;
+
+  for( i = StartAsteroidNumber; i < Last; i++ ) {
+    const LOAstOrbSnapshotRecord & Source = pRecords[ i ];
+
+    Count++;
+
+    Record.Count                = Count;
+    Record.Flags                = Source.Flags;
+    Record.AsteroidID           = Source.AsteroidID;
+    Record.Brightness           = Source.Brightness;
+    Record.Slope                = Source.Slope;
+    Record.Diameter             = Source.Diameter;
+    Record.ObservationEpoch     = Source.ObservationEpoch;
+    Record.M                    = Source.M;
+    Record.W                    = Source.W;
+    Record.O                    = Source.O;
+    Record.I                    = Source.I;
+    Record.E                    = Source.E;
+    Record.A                    = Source.A;
+    Record.EphemerisUncertainty = Source.EphemerisUncertainty;
+
+    NameLength = std::min( Source.NameLength, static_cast<int>( apsastroio::ASTER_NAME_LENGTH ) );
+
+    memcpy( Record.AsteroidName, pNames + Source.NameOffset, NameLength );
+    Record.AsteroidName[ NameLength ] = '\0';
+
+    if( IfDiameterInLimits( pFilter, Record ) && FinishRecord( pFilter, Record, UpdatesNumber ) ) {
+      AddAsteroid( pLOAstOrbData, Record, ShownCount );
+    }
+    else {
+      SkippedNumber++;
+    }
+  }
+
+  ShowProgress( ShownCount, Count );
+}
+
+int LOAstOrbReader :: ReadSnapshot( LOAstOrbData * pLOAstOrbData, const LOAstOrbFilter * pFilter,
+                                    const char * pData, const size_t Length,
+                                    const int StartAsteroidNumber, const int EndAsteroidNumber,
+                                    int & Count, int & SkippedNumber )
+{
+  LOAstOrbSnapshot                    Snapshot( pModule->GetAstOrbSnapshotFilePath() );
+  LOAstOrbSnapshotHeader              Header;
+  std::vector<LOAstOrbChunk>          Chunks;
+  std::vector<LOAstOrbSnapshotRecord> Records;
+  std::string                         Names;
+  struct stat                         Stat;
+
+  memset( &Header, 0, sizeof( Header ) );
+
+  if( stat( GetFileName().c_str(), &Stat ) ) {
+    return( 1 );
+  }
+
+  Header.SourceSize     = Length;
+  Header.SourceTime     = Stat.st_mtime;
+  Header.SourceChecksum = apslib::APSChecksum( pData, Length );
+
+  if( Snapshot.Open() && Snapshot.IfSource( Header.SourceSize, Header.SourceTime, Header.SourceChecksum ) ) {
+    SnapshotMessage = LO_AST_ORB_READER_SNAPSHOT_READ;
+
+    AddSnapshotAsteroids( pLOAstOrbData, pFilter, Snapshot.GetRecordPtr( 0 ), Snapshot.GetNamesPtr(), Snapshot.GetRecordsNumber(),
+                          StartAsteroidNumber, EndAsteroidNumber, Count, SkippedNumber );
+  }
+  else {
+    Snapshot.Close();
+
+    // Whole file is parsed without limits, they are applied to the snapshot
+    ParseChunks( pData, pData + Length, 0, Chunks );
+
+    MakeSnapshot( Chunks, Records, Names );
+
+    SnapshotMessage = LOAstOrbSnapshot :: Write( pModule->GetAstOrbSnapshotFilePath(), Header, Records, Names ) ?
+                      LO_AST_ORB_READER_SNAPSHOT_WRITTEN : LO_AST_ORB_READER_SNAPSHOT_WRITE;
+
+    AddSnapshotAsteroids( pLOAstOrbData, pFilter, Records.empty() ? 0 : &Records[ 0 ], Names.data(), Records.size(),
+                          StartAsteroidNumber, EndAsteroidNumber, Count, SkippedNumber );
+  }
+
+  return( 0 );
+}
+
+int LOAstOrbReader :: ReadMapped( LOAstOrbData * pLOAstOrbData, LOUpdateData * pLOUpdateData,
+                                  const int StartAsteroidNumber, const int EndAsteroidNumber,
+                                  int & Count, int & SkippedNumber )
+{
+  apslib::APSIMMapFile       AstOrbFile( GetFileName() );
+  LOAstOrbFilter             Filter;
+  std::vector<LOAstOrbChunk> Chunks;
+  const char               * pData;
+  size_t                     Length;
+  int                        ShownCount;
+  unsigned int               i;
+  unsigned int               j;
+  int                        RetCode = 0;
+
+  if( !AstOrbFile.Open() ) {
+    return( 1 );
+  }
+
+  Filter.pLOUpdateData       = pLOUpdateData;
+  Filter.UpdatesExpirePeriod = pModule->GetUpdatesExpirePeriod();
+  Filter.IfOneAsteroid       = pModule->GetIfOneAsteroid();
+  Filter.IfOverrideAll       = pModule->GetAsteroidNumber() ||
+                               ( pModule->GetStartAsteroidNumber() == pModule->GetEndAsteroidNumber() );
+  Filter.ObservationEpoch    = pModule->GetObservationEpoch();
+  Filter.M                   = pModule->GetOrbitM();
+  Filter.W                   = pModule->GetOrbitW();
+  Filter.O                   = pModule->GetOrbitO();
+  Filter.I                   = pModule->GetOrbitI();
+  Filter.E                   = pModule->GetOrbitE();
+  Filter.A                   = pModule->GetOrbitA();
+  Filter.MinA                = pModule->GetMinA();
+  Filter.MaxA                = pModule->GetMaxA();
+  Filter.MinDiameter         = pModule->GetMinDiameter();
+  Filter.MaxDiameter         = pModule->GetMaxDiameter();
+
+  pData  = AstOrbFile.GetData();
+  Length = AstOrbFile.GetLength();
+
+  SkippedNumber = 0;
+
+  if( pModule->IfAstOrbSnapshotFilePath() ) {
+    RetCode = ReadSnapshot( pLOAstOrbData, &Filter, pData, Length, StartAsteroidNumber, EndAsteroidNumber, Count, SkippedNumber );
+  }
+  else {
+    ParseChunks( pData + std::min( static_cast<size_t>( StartAsteroidNumber ) * GetRecordLength(), Length ),
+                 pData + std::min( static_cast<size_t>( EndAsteroidNumber ) * GetRecordLength(), Length ),
+                 &Filter, Chunks );
+
+    Count      = 0;
+    ShownCount = 0;
+
+    for( i = 0; i < Chunks.size(); i++ ) {
+      for( j = 0; j < Chunks[ i ].Records.size(); j++ ) {
+        Chunks[ i ].Records[ j ].Count += Count;
+
+        AddAsteroid( pLOAstOrbData, Chunks[ i ].Records[ j ], ShownCount );
+      }
+
+      Count         += Chunks[ i ].LinesNumber;
+      SkippedNumber += Chunks[ i ].SkippedNumber;
+      UpdatesNumber += Chunks[ i ].UpdatesNumber;
+
+      ShowProgress( ShownCount, Count );
+
+      std::vector<LOAstOrbRecord>().swap( Chunks[ i ].Records );
+    }
+  }
+
+  AstOrbFile.Close();
+
+  return( RetCode );
+}
+
 int LOAstOrbReader :: Read( LOData * pLOData )
 {
   LOAstOrbData * pLOAstOrbData;
@@ -715,6 +1383,8 @@ int LOAstOrbReader :: Read( LOData * pLOData )
   int            Count;
   int            StartAsteroidNumber;
   int            EndAsteroidNumber;
+  int            SkippedNumber;
+  bool           IfMapped;
   int            RetCode = LO_AST_ORB_READER_NO_ERROR;
 
   if( Open() ) {
@@ -727,7 +1397,8 @@ int LOAstOrbReader :: Read( LOData * pLOData )
 
     AsteroidNumber = pModule->GetAsteroidNumber();
 
-    UpdatesNumber = 0;
+    UpdatesNumber   = 0;
+    SnapshotMessage = 0;
 
     if( !AsteroidNumber ) {
       Count = 0;
@@ -747,14 +1418,24 @@ int LOAstOrbReader :: Read( LOData * pLOData )
         pModule->InfoMessage( LO_AST_ORB_READER_START_READING, Msg.str() );
       }
 
-      if( GoToRecord( StartAsteroidNumber ) ) {
-        while( ReadStr() ) {
-          Count++;
+      SkippedNumber = 0;
+
+      IfMapped = !ReadMapped( pLOAstOrbData, pLOUpdateData, StartAsteroidNumber, EndAsteroidNumber, Count, SkippedNumber );
+
+      if( !IfMapped ) {
+        pModule->WarningMessage( LO_AST_ORB_READER_MAP_FILE );
+      }
+
+      if( IfMapped || GoToRecord( StartAsteroidNumber ) ) {
+        if( !IfMapped ) { // Mapping has failed, read line by line
+          while( ReadStr() ) {
+            Count++;
 
-          ReadOneAsteroid( pLOAstOrbData, pLOUpdateData, Count );
+            ReadOneAsteroid( pLOAstOrbData, pLOUpdateData, Count );
 
-          if( Count >= EndAsteroidNumber - StartAsteroidNumber ) {
-            break;
+            if( Count >= EndAsteroidNumber - StartAsteroidNumber ) {
+              break;
+            }
           }
         }
 
@@ -769,6 +1450,21 @@ int LOAstOrbReader :: Read( LOData * pLOData )
           Msg << Count << " records." << std::endl;
           pModule->InfoMessage( LO_AST_ORB_READER_FINISH_READING, Msg.str() );
         }
+
+        if( SkippedNumber ) {
+          std::ostringstream Msg;
+          Msg << SkippedNumber << " records." << std::endl;
+          pModule->InfoMessage( LO_AST_ORB_READER_SKIPPED_ASTEROIDS, Msg.str() );
+        }
+
+        if( SnapshotMessage == LO_AST_ORB_READER_SNAPSHOT_WRITE ) {
+          pModule->WarningMessage( SnapshotMessage );
+        }
+        else if( SnapshotMessage ) {
+          std::ostringstream Msg;
+          Msg << pModule->GetAstOrbSnapshotFilePath() << std::endl;
+          pModule->InfoMessage( SnapshotMessage, Msg.str() );
+        }
       }
       else {
         pModule->ErrorMessage( LO_AST_ORB_SEEK );
@@ -9,6 +9,8 @@
 //
 // Initial version 0.1 31.01.2004
 // version 0.2 17.04.2005 Updates database was added
+// version 0.3 19.10.2026 Mapped file parallel reader was added
+// version 0.4 19.10.2026 Astorb snapshot was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -30,8 +32,10 @@
 #define LO_ASTORB_READER_H
 
 #include <string>
+#include <vector>
 
 #include "AstOrbReader.h"
+#include "apsastorbdefs.h"
 
 namespace aps {
 
@@ -44,6 +48,65 @@ class LOData;
 class LOAstOrbData;
 class LOUpdateData;
 class LOAstOrbReadSubModule;
+struct LOAstOrbSnapshotRecord;
+
+//======================= LOAstOrbRecord ==========================
+
+/* Columns of one astorb.dat line used by LinOccult, final orbit elements */
+struct LOAstOrbRecord
+{
+  int          Count;
+  unsigned int Flags;
+  int          AsteroidID;
+  char         AsteroidName[ apsastroio::ASTER_NAME_LENGTH + 1 ];
+  double       Brightness;
+  double       Slope;
+  double       Diameter;
+  double       ObservationEpoch;
+  double       M;
+  double       W;
+  double       O;
+  double       I;
+  double       E;
+  double       A;
+  double       EphemerisUncertainty;
+};
+
+//======================= LOAstOrbFilter ==========================
+
+/* Read only parameters shared by all chunk workers */
+struct LOAstOrbFilter
+{
+  const LOUpdateData * pLOUpdateData;
+  int                  UpdatesExpirePeriod;
+  int                  IfOneAsteroid;
+  bool                 IfOverrideAll;
+  double               ObservationEpoch;
+  double               M;
+  double               W;
+  double               O;
+  double               I;
+  double               E;
+  double               A;
+  double               MinA;
+  double               MaxA;
+  double               MinDiameter;
+  double               MaxDiameter;
+};
+
+//======================= LOAstOrbChunk ==========================
+
+/* Part of mapped astorb.dat from one line start to another one */
+struct LOAstOrbChunk
+{
+  const char                  * pBegin;
+  const char                  * pEnd;
+  const LOAstOrbFilter        * pFilter;
+  int                           LinesNumber;
+  int                           SkippedNumber;
+  int                           UpdatesNumber;
+  std::vector<LOAstOrbRecord>   Records;
+};
 
 //======================= LOAstOrbReader ==========================
 
@@ -53,9 +116,49 @@ class LOAstOrbReader : protected AstOrbReader
 
     LOModuleAstOrbReader * pModule;
     int                    UpdatesNumber;
+    int                    SnapshotMessage;
 
     int ReadOneAsteroid( LOAstOrbData * pLOAstOrbData, LOUpdateData * pLOUpdateData, const int Count );
 
+    static void ParseHead( const char * pLine, const size_t LineLength, LOAstOrbRecord & Record );
+
+    static void ParseElements( const char * pLine, const size_t LineLength, LOAstOrbRecord & Record );
+
+    static bool IfDiameterInLimits( const LOAstOrbFilter * pFilter, const LOAstOrbRecord & Record );
+
+    static bool FinishRecord( const LOAstOrbFilter * pFilter, LOAstOrbRecord & Record, int & UpdatesNumber );
+
+    /* Without filter all lines are parsed and kept */
+    static void ParseChunk( LOAstOrbChunk * pChunk );
+
+    static void * ParseChunkThread( void * pArg );
+
+    void ShowProgress( int & ShownCount, const int Count ) const;
+
+    int AddAsteroid( LOAstOrbData * pLOAstOrbData, const LOAstOrbRecord & Record, int & ShownCount );
+
+    void ParseChunks( const char * pBegin, const char * pEnd, const LOAstOrbFilter * pFilter,
+                      std::vector<LOAstOrbChunk> & Chunks ) const;
+
+    void MakeSnapshot( std::vector<LOAstOrbChunk> & Chunks,
+                       std::vector<LOAstOrbSnapshotRecord> & Records, std::string & Names ) const;
+
+    void AddSnapshotAsteroids( LOAstOrbData * pLOAstOrbData, const LOAstOrbFilter * pFilter,
+                               const LOAstOrbSnapshotRecord * pRecords, const char * pNames,
+                               const int RecordsNumber,
+                               const int StartAsteroidNumber, const int EndAsteroidNumber,
+                               int & Count, int & SkippedNumber );
+
+    /* Reads records from snapshot file, rebuilds it when astorb.dat was changed */
+    int ReadSnapshot( LOAstOrbData * pLOAstOrbData, const LOAstOrbFilter * pFilter,
+                      const char * pData, const size_t Length,
+                      const int StartAsteroidNumber, const int EndAsteroidNumber,
+                      int & Count, int & SkippedNumber );
+
+    int ReadMapped( LOAstOrbData * pLOAstOrbData, LOUpdateData * pLOUpdateData,
+                    const int StartAsteroidNumber, const int EndAsteroidNumber,
+                    int & Count, int & SkippedNumber );
+
   public:
 
     LOAstOrbReader( LOAstOrbReadSubModule * pLOAstOrbReadSubModule, const std::string & AstOrbFilePath );
@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+//
+// File:    loAstOrbSnapshot.cc
+//
+// Purpose: Binary snapshot of parsed astorb.dat.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+
+#include "apsimmapfile.h"
+#include "apsobinfile.h"
+#include "apshash.h"
+
+#include "loAstOrbSnapshot.h"
+
+namespace aps {
+
+  namespace apslinoccult {
+
+//======================= LOAstOrbSnapshot ==========================
+
+LOAstOrbSnapshot :: LOAstOrbSnapshot( const std::string & SnapshotFileName ) :
+                    pHeader( 0 ), pRecords( 0 ), pNames( 0 )
+{
+  pSnapshotFile = new APSIMMapFile( SnapshotFileName );
+}
+
+LOAstOrbSnapshot :: ~LOAstOrbSnapshot( void )
+{
+  Close();
+
+  delete pSnapshotFile;
+}
+
+bool LOAstOrbSnapshot :: Open( void )
+{
+  const LOAstOrbSnapshotHeader * pTmpHeader;
+  int                            i;
+
+  if( !pSnapshotFile->Open() ) {
+    return( false );
+  }
+
+  pTmpHeader = reinterpret_cast<const LOAstOrbSnapshotHeader *>( pSnapshotFile->GetRecord( 0, sizeof( LOAstOrbSnapshotHeader ) ) );
+
+  if( pTmpHeader &&
+      ( pTmpHeader->Descriptor == ASTORB_SNAPSHOT_DESCRIPTOR ) &&
+      ( pTmpHeader->Version == ASTORB_SNAPSHOT_VERSION ) &&
+      ( pTmpHeader->RecordSize == sizeof( LOAstOrbSnapshotRecord ) ) &&
+      ( pTmpHeader->RecordsNumber >= 0 ) && ( pTmpHeader->NamesSize >= 0 ) &&
+      ( pTmpHeader->RecordsOffset >= 0 ) && ( pTmpHeader->NamesOffset >= 0 ) ) {
+    pRecords = reinterpret_cast<const LOAstOrbSnapshotRecord *>(
+                 pSnapshotFile->GetRecord( pTmpHeader->RecordsOffset,
+                                           static_cast<size_t>( pTmpHeader->RecordsNumber ) * sizeof( LOAstOrbSnapshotRecord ) ) );
+    pNames   = pSnapshotFile->GetRecord( pTmpHeader->NamesOffset, pTmpHeader->NamesSize );
+
+    if( pRecords && pNames ) {
+      for( i = 0; i < pTmpHeader->RecordsNumber; i++ ) {
+        if( ( pRecords[ i ].NameOffset < 0 ) || ( pRecords[ i ].NameLength < 0 ) ||
+            ( pRecords[ i ].NameOffset + static_cast<int64_t>( pRecords[ i ].NameLength ) > pTmpHeader->NamesSize ) ) {
+          break;
+        }
+      }
+
+      if( i == pTmpHeader->RecordsNumber ) {
+        pHeader = pTmpHeader;
+
+        return( true );
+      }
+    }
+  }
+
+  Close();
+
+  return( false );
+}
+
+void LOAstOrbSnapshot :: Close( void )
+{
+  pHeader  = 0;
+  pRecords = 0;
+  pNames   = 0;
+
+  pSnapshotFile->Close();
+}
+
+bool LOAstOrbSnapshot :: IfSource( const int64_t SourceSize, const int64_t SourceTime, const uint64_t SourceChecksum ) const
+{
+  if( pHeader ) {
+    return( ( pHeader->SourceSize == SourceSize ) && ( pHeader->SourceTime == SourceTime ) &&
+            ( pHeader->SourceChecksum == SourceChecksum ) );
+  }
+
+  return( false );
+}
+
+uint64_t LOAstOrbSnapshot :: GetElementsHash( const LOAstOrbSnapshotRecord & Record )
+{
+  uint64_t Hash;
+
+  Hash = apslib::APSHash( &Record.ObservationEpoch, sizeof( Record.ObservationEpoch ) );
+  Hash = apslib::APSHash( &Record.M, sizeof( Record.M ), Hash );
+  Hash = apslib::APSHash( &Record.W, sizeof( Record.W ), Hash );
+  Hash = apslib::APSHash( &Record.O, sizeof( Record.O ), Hash );
+  Hash = apslib::APSHash( &Record.I, sizeof( Record.I ), Hash );
+  Hash = apslib::APSHash( &Record.E, sizeof( Record.E ), Hash );
+  Hash = apslib::APSHash( &Record.A, sizeof( Record.A ), Hash );
+
+  return( Hash );
+}
+
+bool LOAstOrbSnapshot :: Write( const std::string & SnapshotFileName, LOAstOrbSnapshotHeader & Header,
+                                const std::vector<LOAstOrbSnapshotRecord> & Records, const std::string & Names )
+{
+  std::string TmpFileName = SnapshotFileName + ".tmp";
+  bool        RetCode     = false;
+
+  Header.Descriptor    = ASTORB_SNAPSHOT_DESCRIPTOR;
+  Header.Version       = ASTORB_SNAPSHOT_VERSION;
+  Header.RecordSize    = sizeof( LOAstOrbSnapshotRecord );
+  Header.RecordsNumber = Records.size();
+  Header.RecordsOffset = sizeof( LOAstOrbSnapshotHeader );
+  Header.NamesOffset   = Header.RecordsOffset + static_cast<int64_t>( Records.size() ) * sizeof( LOAstOrbSnapshotRecord );
+  Header.NamesSize     = Names.length();
+
+  apslib::APSOBinFile SnapshotFile( TmpFileName );
+
+  if( SnapshotFile.Open() ) {
+    RetCode = SnapshotFile.PutRecord( &Header, sizeof( Header ) );
+
+    if( RetCode && !Records.empty() ) {
+      RetCode = SnapshotFile.PutRecord( &Records[ 0 ], Records.size() * sizeof( LOAstOrbSnapshotRecord ) );
+    }
+
+    if( RetCode && !Names.empty() ) {
+      RetCode = SnapshotFile.PutRecord( Names.data(), Names.length() );
+    }
+
+    if( !SnapshotFile.Close() ) {
+      RetCode = false;
+    }
+
+    if( RetCode ) {
+      RetCode = !std::rename( TmpFileName.c_str(), SnapshotFileName.c_str() );
+    }
+
+    if( !RetCode ) {
+      std::remove( TmpFileName.c_str() );
+    }
+  }
+
+  return( RetCode );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
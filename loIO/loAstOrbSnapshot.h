@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+//
+// File:    loAstOrbSnapshot.h
+//
+// Purpose: Binary snapshot of parsed astorb.dat.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef LO_ASTORB_SNAPSHOT_H
+#define LO_ASTORB_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+namespace aps {
+
+  namespace apslib {
+    class APSIMMapFile;
+  }
+
+  namespace apslinoccult {
+
+using apslib::APSIMMapFile;
+
+const unsigned int ASTORB_SNAPSHOT_DESCRIPTOR = 0x534F4C41;
+const int          ASTORB_SNAPSHOT_VERSION    = 1;
+
+/*
+  Snapshot layout:
+
+    LOAstOrbSnapshotHeader
+    LOAstOrbSnapshotRecord [ RecordsNumber ]  one per astorb.dat line, in file order
+    char                   [ NamesSize ]      asteroid names string table
+
+  Records keep the values of astorb.dat itself, updates and
+  limits of the current run are applied after reading.
+*/
+
+#pragma pack(1)
+
+struct LOAstOrbSnapshotHeader
+{
+  unsigned int Descriptor;
+  int          Version;
+  int          RecordSize;
+  int          RecordsNumber;
+  int64_t      RecordsOffset;
+  int64_t      NamesOffset;
+  int64_t      NamesSize;
+  int64_t      SourceSize;      /* astorb.dat length */
+  int64_t      SourceTime;      /* astorb.dat modification time */
+  uint64_t     SourceChecksum;  /* APSChecksum of astorb.dat */
+};
+
+struct LOAstOrbSnapshotRecord
+{
+  double       Brightness;
+  double       Slope;
+  double       Diameter;
+  double       ObservationEpoch;
+  double       M;
+  double       W;
+  double       O;
+  double       I;
+  double       E;
+  double       A;
+  double       EphemerisUncertainty;
+  uint64_t     ElementsHash;    /* APSHash of ObservationEpoch and M, W, O, I, E, A */
+  int          AsteroidID;
+  unsigned int Flags;           /* parse errors of the line */
+  int          NameOffset;
+  int          NameLength;
+};
+
+#pragma pack()
+
+//======================= LOAstOrbSnapshot ==========================
+
+class LOAstOrbSnapshot
+{
+  private:
+
+    APSIMMapFile                 * pSnapshotFile;
+    const LOAstOrbSnapshotHeader * pHeader;
+    const LOAstOrbSnapshotRecord * pRecords;
+    const char                   * pNames;
+
+  public:
+
+    LOAstOrbSnapshot( const std::string & SnapshotFileName );
+
+    virtual ~LOAstOrbSnapshot( void );
+
+    /* Maps file and checks its structure */
+    bool Open( void );
+
+    void Close( void );
+
+    bool IfSource( const int64_t SourceSize, const int64_t SourceTime, const uint64_t SourceChecksum ) const;
+
+    int GetRecordsNumber( void ) const
+      { return( pHeader ? pHeader->RecordsNumber : 0 ); }
+
+    const LOAstOrbSnapshotRecord * GetRecordPtr( const int RecordNumber ) const
+      { return( pRecords + RecordNumber ); }
+
+    const char * GetNamePtr( const LOAstOrbSnapshotRecord * pRecord ) const
+      { return( pNames + pRecord->NameOffset ); }
+
+    const char * GetNamesPtr( void ) const
+      { return( pNames ); }
+
+    static uint64_t GetElementsHash( const LOAstOrbSnapshotRecord & Record );
+
+    /* Writes file under temporary name and renames it */
+    static bool Write( const std::string & SnapshotFileName, LOAstOrbSnapshotHeader & Header,
+                       const std::vector<LOAstOrbSnapshotRecord> & Records, const std::string & Names );
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
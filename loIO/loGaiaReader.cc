@@ -8,6 +8,7 @@
 //
 // Initial version 0.1 15.02.2004
 // Gaia EDR3       0.2 10.01.2021
+//                 0.3 19.10.2026 Star index file was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -28,6 +29,7 @@
 #include <sstream>
 #include <iostream>
 #include <iomanip>
+#include <cstring>
 
 #include "apsmathconst.h"
 #include "apsastroconst.h"
@@ -35,9 +37,13 @@
 #include "apsvec3d.h"
 #include "apsprecnut.h"
 
+#include "apsgaiaedr3defs.h"
+
 #include "loGaiaReader.h"
 #include "loData.h"
 #include "loStarData.h"
+#include "loStar.h"
+#include "loStarIndex.h"
 #include "loModuleGaiaReader.h"
 #include "loGaiaReadSubModule.h"
 
@@ -60,29 +66,10 @@ LOGaiaReader :: ~LOGaiaReader( void )
 
 int LOGaiaReader :: Read( LOData * pLOData )
 {
-  const double  UasPerDeg = 3600000000.0;
-  int32_t       RA;
-  bool          IfRA;
-  unsigned char RA2;
-  int32_t       Dec;
-  bool          IfDec;
-  unsigned char Dec2;
-  uint16_t      Parallax;
-  int32_t       pmRA;
-  int32_t       pmDec;
-  int16_t       Vrad;
-  uint16_t      Epoch;
-  double        epoch;
-  int16_t       Mv;
-  unsigned char Catalogue;
-  uint32_t      StarNumber;
-  LOStarData  * pLOStarData;
-  off_t         StarsNumber;
-  float         Tmp1;
-  float         Tmp2;
-  float         Tmp3;
-  int           Count;
-  int           RetCode = LO_GAIA_READER_NO_ERROR;
+  LOStarIndexHeader Source;
+  LOStarData      * pLOStarData;
+  bool              IfSource = false;
+  int               RetCode  = LO_GAIA_READER_NO_ERROR;
 
   if( pModule->GetIfOneStar() ) {
     pLOStarData = pLOData->CreateStarData( 1 );
@@ -110,6 +97,95 @@ int LOGaiaReader :: Read( LOData * pLOData )
     return( RetCode );
   }
 
+  if( pModule->IfStarIndexFilePath() ) {
+    memset( &Source, 0, sizeof( Source ) );
+
+    Source.MaxMv              = pModule->GetMaxMv();
+    Source.SourceRecordLength = apsastroio::GAIA_EDR3_RECORD_LENGTH;
+
+    IfSource = LOStarIndex :: GetSource( GetFileName(), Source );
+
+    if( IfSource && ReadIndex( pLOData, Source ) ) {
+      return( RetCode );
+    }
+  }
+
+  RetCode = ReadCatalog( pLOData );
+
+  if( !RetCode && IfSource ) {
+    WriteIndex( pLOData, Source );
+  }
+
+  return( RetCode );
+}
+
+bool LOGaiaReader :: ReadIndex( LOData * pLOData, const LOStarIndexHeader & Source )
+{
+  LOStarIndex    Index( pModule->GetStarIndexFilePath() );
+  LOStarData   * pLOStarData;
+  const LOStar * pStars;
+  const void   * pNodes;
+  int            StarsNumber;
+  int            NodesNumber;
+
+  if( !Index.Open() || !Index.IfSource( Source ) ) {
+    return( false );
+  }
+
+  pStars      = Index.GetStarsPtr();
+  pNodes      = Index.GetNodesPtr();
+  StarsNumber = Index.GetStarsNumber();
+  NodesNumber = Index.GetNodesNumber();
+
+  pLOStarData = pLOData->CreateStarData( 0 );
+
+  pLOStarData->AttachIndex( Index.Release(), pStars, StarsNumber, pNodes, NodesNumber );
+
+  std::ostringstream Msg;
+  Msg << pModule->GetStarIndexFilePath() << ": " << pLOStarData->GetStarsNumber() << " stars." << std::endl;
+  pModule->InfoMessage( LO_GAIA_READER_INDEX_READ, Msg.str() );
+
+  return( true );
+}
+
+void LOGaiaReader :: WriteIndex( LOData * pLOData, LOStarIndexHeader & Source ) const
+{
+  if( !pLOData->BuildKDTree( pModule->GetKDTreeThreadsNumber() ) && LOStarIndex :: Write( pModule->GetStarIndexFilePath(), Source, pLOData->GetStarDataPtr() ) ) {
+    std::ostringstream Msg;
+    Msg << pModule->GetStarIndexFilePath() << std::endl;
+    pModule->InfoMessage( LO_GAIA_READER_INDEX_WRITTEN, Msg.str() );
+  }
+  else {
+    pModule->WarningMessage( LO_GAIA_READER_INDEX_WRITE );
+  }
+}
+
+int LOGaiaReader :: ReadCatalog( LOData * pLOData )
+{
+  const double  UasPerDeg = 3600000000.0;
+  int32_t       RA;
+  bool          IfRA;
+  unsigned char RA2;
+  int32_t       Dec;
+  bool          IfDec;
+  unsigned char Dec2;
+  uint16_t      Parallax;
+  int32_t       pmRA;
+  int32_t       pmDec;
+  int16_t       Vrad;
+  uint16_t      Epoch;
+  double        epoch;
+  int16_t       Mv;
+  unsigned char Catalogue;
+  uint32_t      StarNumber;
+  LOStarData  * pLOStarData;
+  off_t         StarsNumber;
+  float         Tmp1;
+  float         Tmp2;
+  float         Tmp3;
+  int           Count;
+  int           RetCode = LO_GAIA_READER_NO_ERROR;
+
   if( Open() ) {
     Count = 0;
 
@@ -302,5 +378,4 @@ int LOGaiaReader :: Read( LOData * pLOData )
 }
 
 }}
-
 //---------------------------- End of file ---------------------------
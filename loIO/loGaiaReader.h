@@ -8,6 +8,7 @@
 //
 // Initial version 0.1 15.02.2004
 // Gaia EDR3       0.2 10.01.2021
+//                 0.3 19.10.2026 Star index file was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -45,6 +46,7 @@ using apsastroio::GaiaEDR3Reader;
 class LOModuleGaiaReader;
 class LOData;
 class LOGaiaReadSubModule;
+struct LOStarIndexHeader;
 
 //======================= LOGaiaReader ==========================
 
@@ -54,6 +56,13 @@ class LOGaiaReader : protected GaiaEDR3Reader
 
     LOModuleGaiaReader * pModule;
 
+    int ReadCatalog( LOData * pLOData );
+
+    /* Uses star index file if it was built for the same catalog and MaxMv */
+    bool ReadIndex( LOData * pLOData, const LOStarIndexHeader & Source );
+
+    void WriteIndex( LOData * pLOData, LOStarIndexHeader & Source ) const;
+
   public:
 
     LOGaiaReader( LOGaiaReadSubModule * pLOGaiaReadSubModule, const std::string & GaiaFilePath );
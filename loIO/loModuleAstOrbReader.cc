@@ -12,6 +12,8 @@
 //                                OrbitM, OrbitW, OrbitO, OrbitI, OrbitE, OrbitA parameters were added
 // version 0.4 05.03.2005 StartAsteroidNumber, EndAsteroidNumber were added
 // version 0.5 17.04.2005 UpdatesExpirePeriod was added
+// version 0.6 19.10.2026 LO_AST_ORB_READER_MAP_FILE, LO_AST_ORB_READER_THREAD, A and diameter limits were added
+// version 0.7 19.10.2026 Astorb snapshot was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -187,6 +189,18 @@ const std::string LOModuleAstOrbReader :: GetMessageText( const int MsgNumber )
       return("GEU2 month");
     case LO_AST_ORB_READER_GEU2_DAY:
       return("GEU2 day");
+    case LO_AST_ORB_READER_MAP_FILE:
+      return("Can't map asteroid orbits file. Line by line reading is used.\n");
+    case LO_AST_ORB_READER_THREAD:
+      return("Can't create reader thread.\n");
+    case LO_AST_ORB_READER_SKIPPED_ASTEROIDS:
+      return("Asteroids out of A and diameter limits were skipped.");
+    case LO_AST_ORB_READER_SNAPSHOT_READ:
+      return("Asteroid orbits snapshot has been used.");
+    case LO_AST_ORB_READER_SNAPSHOT_WRITTEN:
+      return("Asteroid orbits snapshot has been written.");
+    case LO_AST_ORB_READER_SNAPSHOT_WRITE:
+      return("Can't write asteroid orbits snapshot.\n");
     case LO_AST_ORB_READER_PROGRESS:
       return("*");
     case LO_AST_ORB_NEW_LINE:
@@ -262,6 +276,41 @@ int LOModuleAstOrbReader :: GetUpdatesExpirePeriod( void ) const
   return( GetLOAstOrbReadSubModulePtr()->GetUpdatesExpirePeriod() );
 }
 
+double LOModuleAstOrbReader :: GetMinA( void ) const
+{
+  return( GetLOAstOrbReadSubModulePtr()->GetMinA() );
+}
+
+double LOModuleAstOrbReader :: GetMaxA( void ) const
+{
+  return( GetLOAstOrbReadSubModulePtr()->GetMaxA() );
+}
+
+double LOModuleAstOrbReader :: GetMinDiameter( void ) const
+{
+  return( GetLOAstOrbReadSubModulePtr()->GetMinDiameter() );
+}
+
+double LOModuleAstOrbReader :: GetMaxDiameter( void ) const
+{
+  return( GetLOAstOrbReadSubModulePtr()->GetMaxDiameter() );
+}
+
+int LOModuleAstOrbReader :: GetAstOrbThreadsNumber( void ) const
+{
+  return( GetLOAstOrbReadSubModulePtr()->GetAstOrbThreadsNumber() );
+}
+
+const std::string & LOModuleAstOrbReader :: GetAstOrbSnapshotFilePath( void ) const
+{
+  return( GetLOAstOrbReadSubModulePtr()->GetAstOrbSnapshotFilePath() );
+}
+
+int LOModuleAstOrbReader :: IfAstOrbSnapshotFilePath( void ) const
+{
+  return( GetLOAstOrbReadSubModulePtr()->IfAstOrbSnapshotFilePath() );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
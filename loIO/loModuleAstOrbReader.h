@@ -12,6 +12,8 @@
 //                                OrbitM, OrbitW, OrbitO, OrbitI, OrbitE, OrbitA parameters were added
 // version 0.4 05.03.2005 StartAsteroidNumber, EndAsteroidNumber were added
 // version 0.5 17.04.2005 UpdatesExpirePeriod was added
+// version 0.6 19.10.2026 LO_AST_ORB_READER_MAP_FILE, LO_AST_ORB_READER_THREAD, A and diameter limits were added
+// version 0.7 19.10.2026 Astorb snapshot was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -104,7 +106,13 @@ enum {
   LO_AST_ORB_READER_GREATEST_PEAK2_EPHEMERIS_UNCERTAINTY,
   LO_AST_ORB_READER_GEU2_YEAR,
   LO_AST_ORB_READER_GEU2_MONTH,
-  LO_AST_ORB_READER_GEU2_DAY
+  LO_AST_ORB_READER_GEU2_DAY,
+  LO_AST_ORB_READER_MAP_FILE,
+  LO_AST_ORB_READER_THREAD,
+  LO_AST_ORB_READER_SKIPPED_ASTEROIDS,
+  LO_AST_ORB_READER_SNAPSHOT_READ,
+  LO_AST_ORB_READER_SNAPSHOT_WRITTEN,
+  LO_AST_ORB_READER_SNAPSHOT_WRITE
 };
 
 //======================= LOModuleAstOrbReader ==========================
@@ -148,6 +156,20 @@ class LOModuleAstOrbReader : public APSModule
     int GetEndAsteroidNumber( void ) const;
 
     int GetUpdatesExpirePeriod( void ) const;
+
+    double GetMinA( void ) const;
+
+    double GetMaxA( void ) const;
+
+    double GetMinDiameter( void ) const;
+
+    double GetMaxDiameter( void ) const;
+
+    int GetAstOrbThreadsNumber( void ) const;
+
+    const std::string & GetAstOrbSnapshotFilePath( void ) const;
+
+    int IfAstOrbSnapshotFilePath( void ) const;
 };
 
 }}
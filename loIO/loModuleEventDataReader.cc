@@ -10,6 +10,8 @@
 //         version 0.2 15.02.2005 InputEventsFilePath was added
 //         version 0.3 22.02.2005 InputEventsFilePath was removed.
 //                                StartYear, StartMonth, StartDay, EndYear, EndMonth, EndDay
+//         version 0.4 19.10.2026 LO_EVENT_DATA_READER_WRONG_FOOTER
+//         version 0.5 19.10.2026 LO_EVENT_DATA_READER_NOT_CLOSED was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -60,6 +62,8 @@ const std::string LOModuleEventDataReader :: GetMessageText( const int MsgNumber
       return("Wrong descriptor.\n");
     case LO_EVENT_DATA_READER_HEADER:
       return("Can't read header.\n");
+    case LO_EVENT_DATA_READER_WRONG_FOOTER:
+      return("Wrong events file footer.\n");
     case LO_EVENT_DATA_READER_HEADER_INFO:
       return("Header info: ");
     case LO_EVENT_DATA_READER_EVENT:
@@ -72,6 +76,8 @@ const std::string LOModuleEventDataReader :: GetMessageText( const int MsgNumber
       return("*");
     case LO_EVENT_DATA_READER_NEW_LINE:
       return("\n");
+    case LO_EVENT_DATA_READER_NOT_CLOSED:
+      return("Events stream was not closed, it is read up to the last complete record.");
     default:;
   }
 
@@ -10,6 +10,8 @@
 //         version 0.2 15.02.2005 InputEventsFilePath was added
 //         version 0.3 22.02.2005 InputEventsFilePath was removed.
 //                                StartYear, StartMonth, StartDay, EndYear, EndMonth, EndDay
+//         version 0.4 19.10.2026 LO_EVENT_DATA_READER_WRONG_FOOTER
+//         version 0.5 19.10.2026 LO_EVENT_DATA_READER_NOT_CLOSED was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -48,13 +50,15 @@ enum {
   LO_EVENT_DATA_READER_READ_ERROR,
   LO_EVENT_DATA_READER_WRONG_DESCRIPTOR,
   LO_EVENT_DATA_READER_WRONG_VERSION,
+  LO_EVENT_DATA_READER_WRONG_FOOTER,
   LO_EVENT_DATA_READER_HEADER_INFO,
   LO_EVENT_DATA_READER_HEADER,
   LO_EVENT_DATA_READER_EVENT,
   LO_EVENT_DATA_READER_START_READING,
   LO_EVENT_DATA_READER_FINISH_READING,
   LO_EVENT_DATA_READER_PROGRESS,
-  LO_EVENT_DATA_READER_NEW_LINE
+  LO_EVENT_DATA_READER_NEW_LINE,
+  LO_EVENT_DATA_READER_NOT_CLOSED
 };
 
 //======================= LOModuleEventDataReader ==========================
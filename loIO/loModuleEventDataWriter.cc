@@ -10,6 +10,8 @@
 //         version 0.2 15.02.2005 OutputEventsFilePath was added
 //         version 0.3 22.02.2005 OutputEventsFilePath was removed.
 //                                StartYear, StartMonth, StartDay, EndYear, EndMonth, EndDay
+//         version 0.4 19.10.2026 Events stream messages were added
+//         version 0.5 19.10.2026 Checkpoint and resume messages were added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -64,6 +66,20 @@ const std::string LOModuleEventDataWriter :: GetMessageText( const int MsgNumber
       return("*");
     case LO_EVENT_DATA_WRITER_NEW_LINE:
       return("\n");
+    case LO_EVENT_DATA_WRITER_START_STREAM:
+      return("Start writing events stream:\n");
+    case LO_EVENT_DATA_WRITER_FINISH_STREAM:
+      return("Events stream has been closed.");
+    case LO_EVENT_DATA_WRITER_SYNC:
+      return("Can't synchronize events stream with the disk.\n");
+    case LO_EVENT_DATA_WRITER_CHECKPOINT:
+      return("Can't write checkpoint file:\n");
+    case LO_EVENT_DATA_WRITER_CHECKPOINT_READ:
+      return("Can't read checkpoint file:\n");
+    case LO_EVENT_DATA_WRITER_RESUME_STREAM:
+      return("Events stream is shorter than its checkpoint.\n");
+    case LO_EVENT_DATA_WRITER_RESUME:
+      return("Events stream is resumed:\n");
     default:;
   }
 
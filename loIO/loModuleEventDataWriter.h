@@ -10,6 +10,8 @@
 //         version 0.2 15.02.2005 OutputEventsFilePath was added
 //         version 0.3 22.02.2005 OutputEventsFilePath was removed.
 //                                StartYear, StartMonth, StartDay, EndYear, EndMonth, EndDay
+//         version 0.4 19.10.2026 Events stream messages were added
+//         version 0.5 19.10.2026 Checkpoint and resume messages were added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -50,7 +52,14 @@ enum {
   LO_EVENT_DATA_WRITER_START_WRITING,
   LO_EVENT_DATA_WRITER_FINISH_WRITING,
   LO_EVENT_DATA_WRITER_PROGRESS,
-  LO_EVENT_DATA_WRITER_NEW_LINE
+  LO_EVENT_DATA_WRITER_NEW_LINE,
+  LO_EVENT_DATA_WRITER_START_STREAM,
+  LO_EVENT_DATA_WRITER_FINISH_STREAM,
+  LO_EVENT_DATA_WRITER_SYNC,
+  LO_EVENT_DATA_WRITER_CHECKPOINT,
+  LO_EVENT_DATA_WRITER_CHECKPOINT_READ,
+  LO_EVENT_DATA_WRITER_RESUME_STREAM,
+  LO_EVENT_DATA_WRITER_RESUME
 };
 
 //======================= LOModuleEventDataWriter ==========================
@@ -8,6 +8,8 @@
 //
 // Initial version 0.1 15.02.2004
 // Gaia EDR3       0.2 10.01.2021
+//                 0.3 19.10.2026 Star index file was added
+//                 0.4 19.10.2026 KDTreeThreadsNumber was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -86,6 +88,12 @@ const std::string LOModuleGaiaReader :: GetMessageText( const int MsgNumber ) co
       return("Catalogue");
     case LO_GAIA_READER_STAR_NUMBER:
       return("Star number");
+    case LO_GAIA_READER_INDEX_READ:
+      return("Star index has been used.");
+    case LO_GAIA_READER_INDEX_WRITTEN:
+      return("Star index has been written.");
+    case LO_GAIA_READER_INDEX_WRITE:
+      return("Can't write star index.\n");
     case LO_GAIA_READER_PROGRESS:
       return("*");
     case LO_GAIA_NEW_LINE:
@@ -176,6 +184,21 @@ double LOModuleGaiaReader :: GetEpoch( void ) const
   return( GetLOGaiaReadSubModule()->GetEpoch() );
 }
 
+const std::string & LOModuleGaiaReader :: GetStarIndexFilePath( void ) const
+{
+  return( GetLOGaiaReadSubModule()->GetStarIndexFilePath() );
+}
+
+int LOModuleGaiaReader :: IfStarIndexFilePath( void ) const
+{
+  return( GetLOGaiaReadSubModule()->IfStarIndexFilePath() );
+}
+
+int LOModuleGaiaReader :: GetKDTreeThreadsNumber( void ) const
+{
+  return( GetLOGaiaReadSubModule()->GetKDTreeThreadsNumber() );
+}
+
 }}
 
 //---------------------------- End of file ---------------------------
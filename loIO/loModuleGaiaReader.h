@@ -8,6 +8,8 @@
 //
 // Initial version 0.1 15.02.2004
 // Gaia EDR3       0.2 10.01.2021
+//                 0.3 19.10.2026 Star index file was added
+//                 0.4 19.10.2026 KDTreeThreadsNumber was added
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -62,7 +64,10 @@ enum {
   LO_GAIA_READER_EPOCH,
   LO_GAIA_READER_MV,
   LO_GAIA_READER_CATALOGUE,
-  LO_GAIA_READER_STAR_NUMBER
+  LO_GAIA_READER_STAR_NUMBER,
+  LO_GAIA_READER_INDEX_READ,
+  LO_GAIA_READER_INDEX_WRITTEN,
+  LO_GAIA_READER_INDEX_WRITE
 };
 
 //======================= LOModuleGaiaReader ==========================
@@ -110,6 +115,12 @@ class LOModuleGaiaReader : public APSModule
     double GetVrad( void ) const;
     
     double GetEpoch( void ) const;
+
+    const std::string & GetStarIndexFilePath( void ) const;
+
+    int IfStarIndexFilePath( void ) const;
+
+    int GetKDTreeThreadsNumber( void ) const;
 };
 
 }}
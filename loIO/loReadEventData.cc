@@ -8,6 +8,9 @@
 //
 // Initial version 0.1 13.02.2005
 //         version 0.2 22.02.2005 Start and end data were added
+//         version 0.3 19.10.2026 FILE_VERSION_2 block reading
+//         version 0.4 19.10.2026 FILE_VERSION_2 is memory mapped, only date interval is read
+//         version 0.5 19.10.2026 FILE_VERSION_3 stream reading with recovery of truncated file
 //
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -27,8 +30,12 @@
 
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cstring>
 
 #include "apsibinfile.h"
+#include "apsimmapfile.h"
+#include "apshash.h"
 #include "apsmodule.h"
 #include "apstime.h"
 #include "loData.h"
@@ -44,6 +51,16 @@ namespace aps {
 
 static const int SHOW_EVENT_NUMBER   = 10000;
 
+static bool IfRecordDateLess( const LOEventRecord & Record, const double Mjd )
+{
+  return( Record.BeginOccTime < Mjd );
+}
+
+static bool IfDateRecordLess( const double Mjd, const LOEventRecord & Record )
+{
+  return( Mjd < Record.BeginOccTime );
+}
+
 //======================= LOReadEventData ==========================
 
 LOReadEventData :: LOReadEventData( LOEventDataReaderSubModule * pLOEventDataReaderSubModule,
@@ -59,10 +76,9 @@ LOReadEventData :: ~LOReadEventData( void )
   delete pInputFile;
 }
 
-int LOReadEventData :: ReadHeader( int & RecordsNumber ) const
+int LOReadEventData :: ReadHeader( int & Version, LOEventFileFooter & Footer ) const
 {
   DescriptorType Descriptor;
-  int            Version;
   int            Length;
   std::string    ProgramName;
   int            RetCode = LO_EVENT_DATA_READER_NO_ERROR;
@@ -85,10 +101,10 @@ int LOReadEventData :: ReadHeader( int & RecordsNumber ) const
         if( RetCode1 ) {
           if( pInputFile->GetRecord( &Version, sizeof( Version ) ) ) {        
             if( Version == FILE_VERSION_1 ) {
-              if( pInputFile->GetRecord( &RecordsNumber, sizeof( RecordsNumber ) ) ) {
+              if( pInputFile->GetRecord( &Footer.RecordsNumber, sizeof( Footer.RecordsNumber ) ) ) {
                 std::ostringstream Msg;
                 Msg << "Program " << ProgramName << " version " << Version << " records number " <<
-                       RecordsNumber << "." << std::endl;
+                       Footer.RecordsNumber << "." << std::endl;
                 pModule->InfoMessage( LO_EVENT_DATA_READER_HEADER_INFO, Msg.str() );
               }
               else {
@@ -96,6 +112,29 @@ int LOReadEventData :: ReadHeader( int & RecordsNumber ) const
                 RetCode = LO_EVENT_DATA_READER_READ_ERROR;
               }
             }
+            else if( Version == FILE_VERSION_2 ) {
+              RetCode = ReadFooter( Footer );
+
+              if( !RetCode ) {
+                std::ostringstream Msg;
+                Msg << "Program " << ProgramName << " version " << Version << " records number " <<
+                       Footer.RecordsNumber << "." << std::endl;
+                pModule->InfoMessage( LO_EVENT_DATA_READER_HEADER_INFO, Msg.str() );
+              }
+            }
+            else if( Version == FILE_VERSION_3 ) {
+              if( !ReadStreamFooter( Footer ) ) {
+                std::ostringstream Msg;
+                Msg << "Program " << ProgramName << " version " << Version << " records number " <<
+                       Footer.RecordsNumber << "." << std::endl;
+                pModule->InfoMessage( LO_EVENT_DATA_READER_HEADER_INFO, Msg.str() );
+              }
+              else {
+                std::ostringstream Msg;
+                Msg << "Program " << ProgramName << " version " << Version << "." << std::endl;
+                pModule->InfoMessage( LO_EVENT_DATA_READER_HEADER_INFO, Msg.str() );
+              }
+            }
             else {
               pModule->ErrorMessage( LO_EVENT_DATA_READER_WRONG_VERSION );
               RetCode = LO_EVENT_DATA_READER_WRONG_VERSION;
@@ -129,6 +168,62 @@ int LOReadEventData :: ReadHeader( int & RecordsNumber ) const
   return( RetCode );
 }
 
+int LOReadEventData :: ReadFooter( LOEventFileFooter & Footer ) const
+{
+  if( !pInputFile->Seek( -static_cast<std::streamoff>( sizeof( Footer ) ), std::ios::end ) ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_READER_READ_ERROR );
+    return( LO_EVENT_DATA_READER_READ_ERROR );
+  }
+
+  if( !pInputFile->GetRecord( &Footer, sizeof( Footer ) ) ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_READER_READ_ERROR );
+    return( LO_EVENT_DATA_READER_READ_ERROR );
+  }
+
+  if( ( Footer.Descriptor != LOAbsEventDataIO :: Descriptor ) ||
+      ( Footer.RecordSize != sizeof( LOEventRecord ) ) ||
+      ( Footer.RecordsNumber < 0 ) || ( Footer.CoefNumber < 0 ) || ( Footer.NamesSize < 0 ) ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_READER_WRONG_FOOTER );
+    return( LO_EVENT_DATA_READER_WRONG_FOOTER );
+  }
+
+  return( LO_EVENT_DATA_READER_NO_ERROR );
+}
+
+int LOReadEventData :: ReadStreamFooter( LOEventFileFooter & Footer ) const
+{
+  std::streamoff RecordsOffset;
+  std::streamoff FileLength;
+
+  RecordsOffset = pInputFile->Pos();
+  RecordsOffset = ( RecordsOffset + EVENT_FILE_ALIGNMENT - 1 ) / EVENT_FILE_ALIGNMENT * EVENT_FILE_ALIGNMENT;
+
+  std::memset( &Footer, 0, sizeof( Footer ) );
+
+  if( pInputFile->Seek( 0, std::ios::end ) ) {
+    FileLength = pInputFile->Pos();
+
+    if( ( FileLength >= RecordsOffset + static_cast<std::streamoff>( sizeof( Footer ) ) ) &&
+        pInputFile->Seek( -static_cast<std::streamoff>( sizeof( Footer ) ), std::ios::end ) &&
+        pInputFile->GetRecord( &Footer, sizeof( Footer ) ) ) {
+      if( ( Footer.Descriptor != LOAbsEventDataIO :: Descriptor ) ||
+          ( Footer.RecordSize != sizeof( LOEventRecord ) ) ||
+          !( Footer.Flags & EVENT_FILE_STREAM ) || ( Footer.RecordsNumber < 0 ) ||
+          ( Footer.RecordsOffset != RecordsOffset ) ||
+          ( Footer.CoefOffset + static_cast<std::streamoff>( sizeof( Footer ) ) != FileLength ) ) {
+        std::memset( &Footer, 0, sizeof( Footer ) );
+      }
+    }
+    else {
+      std::memset( &Footer, 0, sizeof( Footer ) );
+    }
+  }
+
+  Footer.RecordsOffset = RecordsOffset;
+
+  return( ( Footer.Flags & EVENT_FILE_STREAM ) ? 0 : 1 );
+}
+
 int LOReadEventData :: ReadEvent( LOEventData * pLOEventData, int & Count,
                                   const double MjdStart, const double MjdEnd ) const
 {
@@ -396,23 +491,184 @@ int LOReadEventData :: ReadEvent( LOEventData * pLOEventData, int & Count,
   return( 0 );
 }
 
+int LOReadEventData :: ReadEvents( LOEventData * pLOEventData, const LOEventFileFooter & Footer, int & Count,
+                                   const double MjdStart, const double MjdEnd ) const
+{
+  int                   i;
+  int                   First;
+  int                   Last;
+  const LOEventRecord * pRecords;
+  const double        * pCoefs;
+  const char          * pNames;
+
+  apslib::APSIMMapFile MapFile( pInputFile->GetFileName() );
+
+  if( !MapFile.Open() ) {
+    return( 1 );
+  }
+
+  pRecords = reinterpret_cast<const LOEventRecord *>(
+               MapFile.GetRecord( Footer.RecordsOffset, Footer.RecordsNumber * sizeof( LOEventRecord ) ) );
+  pCoefs   = reinterpret_cast<const double *>(
+               MapFile.GetRecord( Footer.CoefOffset, Footer.CoefNumber * sizeof( double ) ) );
+  pNames   = MapFile.GetRecord( Footer.NamesOffset, Footer.NamesSize );
+
+  if( !pRecords || !pCoefs || !pNames ) {
+    return( 1 );
+  }
+
+  First = 0;
+  Last  = Footer.RecordsNumber;
+
+  if( Footer.Flags & EVENT_FILE_SORTED_BY_DATE ) {
+    First = std::lower_bound( pRecords, pRecords + Footer.RecordsNumber,
+                              MjdStart - Footer.MaxOccDuration, IfRecordDateLess ) - pRecords;
+    Last  = std::upper_bound( pRecords + First, pRecords + Footer.RecordsNumber,
+                              MjdEnd, IfDateRecordLess ) - pRecords;
+  }
+
+  for( i = First; i < Last; i++ ) {
+    const LOEventRecord & Record = pRecords[ i ];
+
+    if( ( Record.ChebOrder < 0 ) || ( Record.CoefOffset < 0 ) ||
+        ( Record.CoefOffset + 3 * ( Record.ChebOrder + 1 ) > Footer.CoefNumber ) ||
+        ( Record.NameOffset < 0 ) || ( Record.NameLength < 0 ) ||
+        ( Record.NameOffset + Record.NameLength > Footer.NamesSize ) ) {
+      return( 1 );
+    }
+
+    if( IfInInterval( MjdStart, MjdEnd, Record.BeginOccTime, Record.EndOccTime ) ) {
+      const double * pcX = pCoefs + Record.CoefOffset;
+      const double * pcY = pcX + Record.ChebOrder + 1;
+      const double * pcZ = pcY + Record.ChebOrder + 1;
+
+      pLOEventData->CreateEvent( Record.AsteroidID, std::string( pNames + Record.NameOffset, Record.NameLength ),
+                                 Record.Diameter, Record.EphemerisUncertainty,
+                                 Record.ObservationEpoch, Record.M, Record.W, Record.O, Record.I, Record.E, Record.A,
+                                 Record.Catalog, Record.StarNumber, Record.Mv, Record.ChebOrder,
+                                 pcX, pcY, pcZ, Record.ET_UT,
+                                 Record.BeginOccTime, Record.EndOccTime, Record.EarthFlag, Record.MaxDuration,
+                                 Record.StarRA, Record.StarDec, Record.MoonPhase, Record.SunDist, Record.MoonDist,
+                                 Record.Brightness, Record.BrightDelta, Record.Uncertainty );
+      Count++;
+    }
+
+    if( !( ( i - First ) % SHOW_EVENT_NUMBER ) ) {
+      pModule->StrMessage( LO_EVENT_DATA_READER_PROGRESS );
+    }
+  }
+
+  return( 0 );
+}
+
+int LOReadEventData :: ReadStreamEvents( LOEventData * pLOEventData, const LOEventFileFooter & Footer, int & Count,
+                                         const double MjdStart, const double MjdEnd ) const
+{
+  const LOEventFrame  * pFrame;
+  const char          * pData;
+  const double        * pcX;
+  LOEventRecord         Record;
+  size_t                Offset;
+  size_t                End;
+  size_t                Size = 0;
+  int                   RecordsNumber;
+  bool                  IfClosed;
+
+  apslib::APSIMMapFile MapFile( pInputFile->GetFileName() );
+
+  if( !MapFile.Open() ) {
+    return( 1 );
+  }
+
+  IfClosed = ( Footer.Flags & EVENT_FILE_STREAM );
+
+  End = IfClosed ? static_cast<size_t>( Footer.CoefOffset ) : MapFile.GetLength();
+
+  RecordsNumber = 0;
+
+  for( Offset = Footer.RecordsOffset; Offset + sizeof( LOEventFrame ) <= End; Offset += sizeof( LOEventFrame ) + Size ) {
+    pFrame = reinterpret_cast<const LOEventFrame *>( MapFile.GetRecord( Offset, sizeof( LOEventFrame ) ) );
+
+    if( !pFrame || ( pFrame->Descriptor != LOAbsEventDataIO :: Descriptor ) ||
+        ( pFrame->Size < static_cast<int>( sizeof( LOEventRecord ) ) ) ) {
+      break;
+    }
+
+    Size = pFrame->Size;
+
+    if( Size > End - Offset - sizeof( LOEventFrame ) ) {
+      break;
+    }
+
+    pData = MapFile.GetRecord( Offset + sizeof( LOEventFrame ), Size );
+
+    if( !pData || ( apslib::APSHash( pData, Size ) != pFrame->Checksum ) ) {
+      break;
+    }
+
+    std::memcpy( &Record, pData, sizeof( Record ) );
+
+    if( ( Record.ChebOrder < 0 ) || ( Record.NameLength < 0 ) ||
+        ( sizeof( Record ) + 3 * ( Record.ChebOrder + 1 ) * sizeof( double ) + Record.NameLength > Size ) ) {
+      break;
+    }
+
+    if( IfInInterval( MjdStart, MjdEnd, Record.BeginOccTime, Record.EndOccTime ) ) {
+      pcX = reinterpret_cast<const double *>( pData + sizeof( Record ) );
+
+      pLOEventData->CreateEvent( Record.AsteroidID,
+                                 std::string( reinterpret_cast<const char *>( pcX + 3 * ( Record.ChebOrder + 1 ) ),
+                                              Record.NameLength ),
+                                 Record.Diameter, Record.EphemerisUncertainty,
+                                 Record.ObservationEpoch, Record.M, Record.W, Record.O, Record.I, Record.E, Record.A,
+                                 Record.Catalog, Record.StarNumber, Record.Mv, Record.ChebOrder,
+                                 pcX, pcX + Record.ChebOrder + 1, pcX + 2 * ( Record.ChebOrder + 1 ), Record.ET_UT,
+                                 Record.BeginOccTime, Record.EndOccTime, Record.EarthFlag, Record.MaxDuration,
+                                 Record.StarRA, Record.StarDec, Record.MoonPhase, Record.SunDist, Record.MoonDist,
+                                 Record.Brightness, Record.BrightDelta, Record.Uncertainty );
+      Count++;
+    }
+
+    if( !( RecordsNumber % SHOW_EVENT_NUMBER ) ) {
+      pModule->StrMessage( LO_EVENT_DATA_READER_PROGRESS );
+    }
+
+    RecordsNumber++;
+  }
+
+  if( IfClosed ) {
+    // Closed stream has no incomplete frames
+    if( ( Offset != End ) || ( RecordsNumber != Footer.RecordsNumber ) ) {
+      return( 1 );
+    }
+  }
+  else {
+    std::ostringstream Msg;
+    Msg << RecordsNumber << " records are recovered." << std::endl;
+    pModule->WarningMessage( LO_EVENT_DATA_READER_NOT_CLOSED, Msg.str() );
+  }
+
+  return( 0 );
+}
+
 int LOReadEventData :: Read( LOData * pLOData )
 {
-  int           i;
-  int           Count;
-  LOEventData * pLOEventData;
-  double        MjdStart;
-  double        MjdEnd;
-  int           RecordsNumber;
-  int           RetCode = LO_EVENT_DATA_READER_NO_ERROR;
+  int               i;
+  int               Count;
+  LOEventData     * pLOEventData;
+  double            MjdStart;
+  double            MjdEnd;
+  int               Version;
+  LOEventFileFooter Footer;
+  int               RetCode = LO_EVENT_DATA_READER_NO_ERROR;
 
   pLOEventData = pLOData->CreateEventData();
 
   if( pInputFile->Open() ) {
-    if( !ReadHeader( RecordsNumber ) ) {
+    if( !ReadHeader( Version, Footer ) ) {
       {
       std::ostringstream Msg;
-      Msg << RecordsNumber << " records. Start data " << pModule->GetStartYear() <<
+      Msg << Footer.RecordsNumber << " records. Start data " << pModule->GetStartYear() <<
              "/" << std::setfill( '0' ) << std::setw( 2 ) << pModule->GetStartMonth() <<
              "/" << std::setfill( '0' ) << std::setw( 2 ) << pModule->GetStartDay() <<
              " End data " << pModule->GetEndYear() <<
@@ -427,17 +683,31 @@ int LOReadEventData :: Read( LOData * pLOData )
 
       Count = 0;
 
-      for( i = 0; i < RecordsNumber; i++ ) {
-        RetCode = ReadEvent( pLOEventData, Count, MjdStart, MjdEnd );
-
-        if( RetCode ) {
+      if( Version == FILE_VERSION_2 ) {
+        if( ReadEvents( pLOEventData, Footer, Count, MjdStart, MjdEnd ) ) {
           pModule->ErrorMessage( LO_EVENT_DATA_READER_EVENT );
           RetCode = LO_EVENT_DATA_READER_EVENT;
-          break;
         }
+      }
+      else if( Version == FILE_VERSION_3 ) {
+        if( ReadStreamEvents( pLOEventData, Footer, Count, MjdStart, MjdEnd ) ) {
+          pModule->ErrorMessage( LO_EVENT_DATA_READER_EVENT );
+          RetCode = LO_EVENT_DATA_READER_EVENT;
+        }
+      }
+      else {
+        for( i = 0; i < Footer.RecordsNumber; i++ ) {
+          RetCode = ReadEvent( pLOEventData, Count, MjdStart, MjdEnd );
 
-        if( !( i % SHOW_EVENT_NUMBER ) ) {
-          pModule->StrMessage( LO_EVENT_DATA_READER_PROGRESS );
+          if( RetCode ) {
+            pModule->ErrorMessage( LO_EVENT_DATA_READER_EVENT );
+            RetCode = LO_EVENT_DATA_READER_EVENT;
+            break;
+          }
+
+          if( !( i % SHOW_EVENT_NUMBER ) ) {
+            pModule->StrMessage( LO_EVENT_DATA_READER_PROGRESS );
+          }
         }
       }
 
@@ -7,6 +7,8 @@
 // (c) 2005 Plekhanov Andrey
 //
 // Initial version 0.1 13.02.2005
+//         version 0.2 19.10.2026 FILE_VERSION_2 block reading
+//         version 0.3 19.10.2026 FILE_VERSION_3 stream reading with recovery of truncated file
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -55,10 +57,22 @@ class LOReadEventData : public LOAbsEventDataIO
     LOModuleEventDataReader * pModule;
     APSIBinFile             * pInputFile;
 
-    int ReadHeader( int & RecordsNumber ) const;
+    int ReadHeader( int & Version, LOEventFileFooter & Footer ) const;
+
+    int ReadFooter( LOEventFileFooter & Footer ) const;
+
+    /* Footer of FILE_VERSION_3 after the header was read, returns 1 if the stream was not closed */
+    int ReadStreamFooter( LOEventFileFooter & Footer ) const;
 
     int ReadEvent( LOEventData * pLOEventData, int & Count, const double MjdStart, const double MjdEnd ) const;
 
+    int ReadEvents( LOEventData * pLOEventData, const LOEventFileFooter & Footer, int & Count,
+                    const double MjdStart, const double MjdEnd ) const;
+
+    /* Frames of FILE_VERSION_3 up to the footer or up to the last complete one */
+    int ReadStreamEvents( LOEventData * pLOEventData, const LOEventFileFooter & Footer, int & Count,
+                          const double MjdStart, const double MjdEnd ) const;
+
   public:
 
     LOReadEventData( LOEventDataReaderSubModule * pLOEventDataReaderSubModule, const std::string & EventDataFileName );
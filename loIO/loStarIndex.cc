@@ -0,0 +1,220 @@
+//------------------------------------------------------------------------------
+//
+// File:    loStarIndex.cc
+//
+// Purpose: Prebuilt star index file for LinOccult.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include <sys/stat.h>
+
+#include "apsimmapfile.h"
+#include "apsobinfile.h"
+#include "apshash.h"
+
+#include "loStarIndex.h"
+#include "loStarData.h"
+#include "loStar.h"
+
+namespace aps {
+
+  namespace apslinoccult {
+
+const size_t SOURCE_CHECKSUM_LENGTH = 1 << 20;
+const size_t NODES_WRITE_BLOCK      = 1 << 20;
+
+//======================= LOStarIndex ==========================
+
+LOStarIndex :: LOStarIndex( const std::string & IndexFileName ) :
+               pHeader( 0 ), pStars( 0 ), pNodes( 0 )
+{
+  pIndexFile = new APSIMMapFile( IndexFileName );
+}
+
+LOStarIndex :: ~LOStarIndex( void )
+{
+  if( pIndexFile ) {
+    Close();
+
+    delete pIndexFile;
+  }
+}
+
+bool LOStarIndex :: Open( void )
+{
+  const LOStarIndexHeader * pTmpHeader;
+
+  if( !pIndexFile->Open() ) {
+    return( false );
+  }
+
+  pTmpHeader = reinterpret_cast<const LOStarIndexHeader *>( pIndexFile->GetRecord( 0, sizeof( LOStarIndexHeader ) ) );
+
+  if( pTmpHeader &&
+      ( pTmpHeader->Descriptor == STAR_INDEX_DESCRIPTOR ) &&
+      ( pTmpHeader->Version == STAR_INDEX_VERSION ) &&
+      ( pTmpHeader->StarSize == sizeof( LOStar ) ) &&
+      ( pTmpHeader->NodeSize == static_cast<int>( LOStarData :: GetKDTreeNodeSize() ) ) &&
+      ( pTmpHeader->StarsNumber >= 0 ) && ( pTmpHeader->NodesNumber == pTmpHeader->StarsNumber + 1 ) &&
+      ( pTmpHeader->StarsOffset >= static_cast<int64_t>( sizeof( LOStarIndexHeader ) ) ) &&
+      ( pTmpHeader->NodesOffset >= pTmpHeader->StarsOffset ) &&
+      !( pTmpHeader->StarsOffset % sizeof( double ) ) && !( pTmpHeader->NodesOffset % sizeof( double ) ) ) {
+    pStars = reinterpret_cast<const LOStar *>(
+               pIndexFile->GetRecord( pTmpHeader->StarsOffset, static_cast<size_t>( pTmpHeader->StarsNumber ) * sizeof( LOStar ) ) );
+    pNodes = pIndexFile->GetRecord( pTmpHeader->NodesOffset,
+                                    static_cast<size_t>( pTmpHeader->NodesNumber ) * pTmpHeader->NodeSize );
+
+    if( pStars && pNodes ) {
+      pHeader = pTmpHeader;
+
+      return( true );
+    }
+  }
+
+  Close();
+
+  return( false );
+}
+
+void LOStarIndex :: Close( void )
+{
+  pHeader = 0;
+  pStars  = 0;
+  pNodes  = 0;
+
+  pIndexFile->Close();
+}
+
+bool LOStarIndex :: IfSource( const LOStarIndexHeader & Source ) const
+{
+  if( pHeader ) {
+    return( ( pHeader->SourceSize == Source.SourceSize ) && ( pHeader->SourceTime == Source.SourceTime ) &&
+            ( pHeader->SourceChecksum == Source.SourceChecksum ) &&
+            ( pHeader->SourceRecordLength == Source.SourceRecordLength ) &&
+            ( pHeader->MaxMv == Source.MaxMv ) );
+  }
+
+  return( false );
+}
+
+APSIMMapFile * LOStarIndex :: Release( void )
+{
+  APSIMMapFile * pFile = pIndexFile;
+
+  pHeader    = 0;
+  pStars     = 0;
+  pNodes     = 0;
+  pIndexFile = 0;
+
+  return( pFile );
+}
+
+bool LOStarIndex :: GetSource( const std::string & SourceFileName, LOStarIndexHeader & Source )
+{
+  APSIMMapFile SourceFile( SourceFileName );
+  struct stat  Stat;
+  size_t       Length;
+  size_t       Part;
+
+  if( stat( SourceFileName.c_str(), &Stat ) || !SourceFile.Open() ) {
+    return( false );
+  }
+
+  // Whole catalog is too large to be read on every run
+  Length = SourceFile.GetLength();
+  Part   = std::min( Length, SOURCE_CHECKSUM_LENGTH );
+
+  Source.SourceSize     = Length;
+  Source.SourceTime     = Stat.st_mtime;
+  Source.SourceChecksum = apslib::APSChecksum( SourceFile.GetData(), Part ) ^
+                          apslib::APSChecksum( SourceFile.GetData() + Length - Part, Part ) * 31;
+
+  SourceFile.Close();
+
+  return( true );
+}
+
+bool LOStarIndex :: Write( const std::string & IndexFileName, LOStarIndexHeader & Header, const LOStarData * pLOStarData )
+{
+  std::string  TmpFileName = IndexFileName + ".tmp";
+  const char * pNodeData;
+  size_t       NodesLength;
+  size_t       Length;
+  unsigned int i;
+  bool         RetCode     = false;
+
+  Header.Descriptor  = STAR_INDEX_DESCRIPTOR;
+  Header.Version     = STAR_INDEX_VERSION;
+  Header.StarSize    = sizeof( LOStar );
+  Header.NodeSize    = LOStarData :: GetKDTreeNodeSize();
+  Header.StarsNumber = pLOStarData->GetCurrentNumber();
+  Header.NodesNumber = pLOStarData->GetKDTreeNodesNumber();
+  Header.StarsOffset = sizeof( LOStarIndexHeader );
+  Header.NodesOffset = Header.StarsOffset + static_cast<int64_t>( Header.StarsNumber ) * sizeof( LOStar );
+
+  if( Header.NodesNumber != Header.StarsNumber + 1 ) {
+    return( false );
+  }
+
+  apslib::APSOBinFile IndexFile( TmpFileName );
+
+  if( IndexFile.Open() ) {
+    RetCode = IndexFile.PutRecord( &Header, sizeof( Header ) );
+
+    for( i = 0; RetCode && ( i < pLOStarData->GetCurrentNumber() ); i++ ) {
+      RetCode = IndexFile.PutRecord( pLOStarData->GetStarPtr( i ), sizeof( LOStar ) );
+    }
+
+    pNodeData   = static_cast<const char *>( pLOStarData->GetKDTreeNodesPtr() );
+    NodesLength = static_cast<size_t>( Header.NodesNumber ) * Header.NodeSize;
+
+    while( RetCode && NodesLength ) {
+      Length = std::min( NodesLength, NODES_WRITE_BLOCK );
+
+      RetCode = IndexFile.PutRecord( pNodeData, Length );
+
+      pNodeData   += Length;
+      NodesLength -= Length;
+    }
+
+    if( !IndexFile.Close() ) {
+      RetCode = false;
+    }
+
+    if( RetCode ) {
+      RetCode = !std::rename( TmpFileName.c_str(), IndexFileName.c_str() );
+    }
+
+    if( !RetCode ) {
+      std::remove( TmpFileName.c_str() );
+    }
+  }
+
+  return( RetCode );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,135 @@
+//------------------------------------------------------------------------------
+//
+// File:    loStarIndex.h
+//
+// Purpose: Prebuilt star index file for LinOccult.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Kd-tree nodes hold the least Mv of subtree
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef LO_STAR_INDEX_H
+#define LO_STAR_INDEX_H
+
+#include <string>
+
+#include <stdint.h>
+
+namespace aps {
+
+  namespace apslib {
+    class APSIMMapFile;
+  }
+
+  namespace apslinoccult {
+
+using apslib::APSIMMapFile;
+
+class LOStar;
+class LOStarData;
+
+const unsigned int STAR_INDEX_DESCRIPTOR = 0x58444953;
+const int          STAR_INDEX_VERSION    = 2;
+
+/*
+  Star index layout:
+
+    LOStarIndexHeader
+    LOStar      [ StarsNumber ]  stars with Mv not greater than MaxMv, in catalog order
+    KDTree node [ NodesNumber ]  built kd-tree, node values are star numbers,
+                                 node ranks are the least Mv of subtree
+
+  Stars and nodes are used directly from the mapped file, so the file
+  is valid only for the build with the same StarSize and NodeSize.
+*/
+
+#pragma pack(1)
+
+struct LOStarIndexHeader
+{
+  unsigned int Descriptor;
+  int          Version;
+  int          StarSize;
+  int          NodeSize;
+  int          StarsNumber;
+  int          NodesNumber;
+  int64_t      StarsOffset;
+  int64_t      NodesOffset;
+  int64_t      SourceSize;          /* star catalog length */
+  int64_t      SourceTime;          /* star catalog modification time */
+  uint64_t     SourceChecksum;      /* APSChecksum of star catalog head and tail */
+  double       MaxMv;
+  int          SourceRecordLength;  /* star catalog record length */
+  int          Reserved;
+};
+
+#pragma pack()
+
+//======================= LOStarIndex ==========================
+
+class LOStarIndex
+{
+  private:
+
+    APSIMMapFile            * pIndexFile;
+    const LOStarIndexHeader * pHeader;
+    const LOStar            * pStars;
+    const void              * pNodes;
+
+  public:
+
+    LOStarIndex( const std::string & IndexFileName );
+
+    virtual ~LOStarIndex( void );
+
+    /* Maps file and checks its structure */
+    bool Open( void );
+
+    void Close( void );
+
+    bool IfSource( const LOStarIndexHeader & Source ) const;
+
+    int GetStarsNumber( void ) const
+      { return( pHeader ? pHeader->StarsNumber : 0 ); }
+
+    int GetNodesNumber( void ) const
+      { return( pHeader ? pHeader->NodesNumber : 0 ); }
+
+    const LOStar * GetStarsPtr( void ) const
+      { return( pStars ); }
+
+    const void * GetNodesPtr( void ) const
+      { return( pNodes ); }
+
+    /* Mapped file is passed to caller, it must live while stars are used */
+    APSIMMapFile * Release( void );
+
+    /* Fills source stamp of star catalog */
+    static bool GetSource( const std::string & SourceFileName, LOStarIndexHeader & Source );
+
+    /* Writes file under temporary name and renames it */
+    static bool Write( const std::string & IndexFileName, LOStarIndexHeader & Header, const LOStarData * pLOStarData );
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,376 @@
+//------------------------------------------------------------------------------
+//
+// File:    loStreamEventData.cc
+//
+// Purpose: Class for writing occultation events to the file while they are calculated.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Resume and checkpoints
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#include <sstream>
+#include <cstring>
+#include <cstdio>
+#include <cstddef>
+
+#include "apsosyncfile.h"
+#include "apsibinfile.h"
+#include "apshash.h"
+#include "apsmodule.h"
+#include "apsmainmodule.h"
+#include "loEvent.h"
+#include "loStreamEventData.h"
+#include "loModuleEventDataWriter.h"
+#include "loEventDataWriterSubModule.h"
+
+namespace aps {
+
+  namespace apslinoccult {
+
+const int SYNC_PERIOD = 60; // Seconds between synchronizations with the disk
+
+//======================= LOStreamEventData ==========================
+
+LOStreamEventData :: LOStreamEventData( LOEventDataWriterSubModule * pLOEventDataWriterSubModule,
+                                        const std::string & EventDataFileName,
+                                        const std::string & aCheckpointFileName ) : LOAbsEventDataIO(),
+                     CheckpointFileName( aCheckpointFileName ), RecordsOffset( 0 ), RecordsNumber( 0 ), MaxOccDuration( 0.0 ), SyncTime( 0 ),
+                     RetCode( LO_EVENT_DATA_WRITER_NO_ERROR )
+{
+  pModule     = new LOModuleEventDataWriter( pLOEventDataWriterSubModule );
+  pOutputFile = new APSOSyncFile( EventDataFileName );
+}
+
+LOStreamEventData :: ~LOStreamEventData( void )
+{
+  delete pModule;
+  delete pOutputFile;
+}
+
+bool LOStreamEventData :: WriteHeader( void )
+{
+  const apslib::APSMainModule * pMainModule;
+  int                           Version;
+  int                           Length;
+  std::string                   ProgramName;
+
+  if( !pOutputFile->PutRecord( &LOAbsEventDataIO :: Descriptor, sizeof( LOAbsEventDataIO :: Descriptor ) ) ) {
+    return( false );
+  }
+
+  pMainModule = pModule->FindMainModule();
+
+  pMainModule->GetModuleInfo( ProgramName, 1 );
+
+  Length = ProgramName.length();
+
+  if( !pOutputFile->PutRecord( &Length, sizeof( Length ) ) ) {
+    return( false );
+  }
+
+  if( !pOutputFile->PutRecord( ProgramName.c_str(), Length ) ) {
+    return( false );
+  }
+
+  Version = FILE_VERSION_3; /* File version */
+
+  if( !pOutputFile->PutRecord( &Version, sizeof( Version ) ) ) {
+    return( false );
+  }
+
+  return( WriteAlignment() );
+}
+
+bool LOStreamEventData :: WriteAlignment( void )
+{
+  const char Zero[ EVENT_FILE_ALIGNMENT ] = { 0 };
+  int        Length;
+
+  Length = static_cast<int>( pOutputFile->Pos() % EVENT_FILE_ALIGNMENT );
+
+  if( Length ) {
+    return( pOutputFile->PutRecord( Zero, EVENT_FILE_ALIGNMENT - Length ) );
+  }
+
+  return( true );
+}
+
+bool LOStreamEventData :: WriteFooter( void )
+{
+  LOEventFileFooter Footer;
+
+  std::memset( &Footer, 0, sizeof( Footer ) );
+
+  Footer.RecordsOffset  = RecordsOffset;
+  Footer.CoefOffset     = pOutputFile->Pos();
+  Footer.NamesOffset    = pOutputFile->Pos();
+  Footer.MaxOccDuration = MaxOccDuration;
+  Footer.RecordsNumber  = RecordsNumber;
+  Footer.RecordSize     = sizeof( LOEventRecord );
+  Footer.Flags          = EVENT_FILE_STREAM;
+  Footer.Descriptor     = LOAbsEventDataIO :: Descriptor;
+
+  return( pOutputFile->PutRecord( &Footer, sizeof( Footer ) ) );
+}
+
+bool LOStreamEventData :: ReadCheckpoint( LOCheckpointRecord & Record ) const
+{
+  apslib::APSIBinFile File( CheckpointFileName );
+  bool                RetCode;
+
+  if( !File.Open() ) {
+    return( false );
+  }
+
+  RetCode = File.GetRecord( &Record, sizeof( Record ) );
+
+  File.Close();
+
+  return( RetCode && ( Record.Descriptor == LOAbsEventDataIO :: Descriptor ) &&
+          ( Record.Version == CHECKPOINT_VERSION ) &&
+          ( Record.Checksum == apslib::APSHash( &Record, offsetof( LOCheckpointRecord, Checksum ) ) ) );
+}
+
+bool LOStreamEventData :: WriteCheckpoint( const LOCheckpointRecord & Record ) const
+{
+  // New checkpoint replaces the old one only when it is on the disk
+  const std::string TmpFileName = CheckpointFileName + ".tmp";
+
+  apslib::APSOSyncFile File( TmpFileName );
+
+  if( !File.Open() ) {
+    return( false );
+  }
+
+  if( !File.PutRecord( &Record, sizeof( Record ) ) || !File.Sync() ) {
+    File.Close();
+    return( false );
+  }
+
+  if( !File.Close() ) {
+    return( false );
+  }
+
+  return( std::rename( TmpFileName.c_str(), CheckpointFileName.c_str() ) == 0 );
+}
+
+int LOStreamEventData :: Open( void )
+{
+  if( !pOutputFile->Open() ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_WRITER_OPEN_FILE );
+    RetCode = LO_EVENT_DATA_WRITER_OPEN_FILE;
+    return( RetCode );
+  }
+
+  if( !WriteHeader() ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_WRITER_HEADER );
+    RetCode = LO_EVENT_DATA_WRITER_HEADER;
+    return( RetCode );
+  }
+
+  RecordsOffset = pOutputFile->Pos();
+  SyncTime      = time( 0 );
+
+  {
+  std::ostringstream Msg;
+  Msg << pOutputFile->GetFileName() << std::endl;
+  pModule->InfoMessage( LO_EVENT_DATA_WRITER_START_STREAM, Msg.str() );
+  }
+
+  return( RetCode );
+}
+
+int LOStreamEventData :: Resume( LOCheckpoint & Checkpoint )
+{
+  LOCheckpointRecord Record;
+
+  if( !ReadCheckpoint( Record ) ) {
+    std::ostringstream Msg;
+    Msg << CheckpointFileName << std::endl;
+    pModule->ErrorMessage( LO_EVENT_DATA_WRITER_CHECKPOINT_READ, Msg.str() );
+    RetCode = LO_EVENT_DATA_WRITER_CHECKPOINT_READ;
+    return( RetCode );
+  }
+
+  if( !pOutputFile->Open( true ) ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_WRITER_OPEN_FILE );
+    RetCode = LO_EVENT_DATA_WRITER_OPEN_FILE;
+    return( RetCode );
+  }
+
+  // Events of the asteroid being processed at the checkpoint are calculated again
+  if( ( pOutputFile->Pos() < Record.StreamOffset ) || !pOutputFile->Truncate( Record.StreamOffset ) ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_WRITER_RESUME_STREAM );
+    RetCode = LO_EVENT_DATA_WRITER_RESUME_STREAM;
+    return( RetCode );
+  }
+
+  RecordsOffset  = Record.RecordsOffset;
+  RecordsNumber  = Record.RecordsNumber;
+  MaxOccDuration = Record.MaxOccDuration;
+  SyncTime       = time( 0 );
+
+  Checkpoint.AsteroidIndex        = Record.AsteroidIndex;
+  Checkpoint.AsteroidID           = Record.AsteroidID;
+  Checkpoint.SQLNumber            = Record.SQLNumber;
+  Checkpoint.SiteRejectedEvents   = Record.SiteRejectedEvents;
+  Checkpoint.ElongationCulledDays = Record.ElongationCulledDays;
+
+  {
+  std::ostringstream Msg;
+  Msg << pOutputFile->GetFileName() << " " << RecordsNumber << " records, last asteroid " <<
+         Record.AsteroidID << std::endl;
+  pModule->InfoMessage( LO_EVENT_DATA_WRITER_RESUME, Msg.str() );
+  }
+
+  return( RetCode );
+}
+
+void LOStreamEventData :: PutEvent( const LOEvent * pEvent )
+{
+  LOEventFrame  Header;
+  LOEventRecord Record;
+  size_t        CoefsSize;
+  size_t        Size;
+  char        * pData;
+
+  if( RetCode || !pOutputFile->IfOpened() ) {
+    return;
+  }
+
+  const std::string & AsteroidName = pEvent->GetAsteroidNamePtr();
+
+  SetRecord( pEvent, Record );
+
+  Record.NameLength = AsteroidName.length();
+
+  CoefsSize = ( Record.ChebOrder + 1 ) * sizeof( double );
+
+  Size = sizeof( Record ) + 3 * CoefsSize + Record.NameLength;
+  Size = ( Size + EVENT_FILE_ALIGNMENT - 1 ) / EVENT_FILE_ALIGNMENT * EVENT_FILE_ALIGNMENT;
+
+  Frame.assign( sizeof( Header ) + Size, 0 );
+
+  pData = &Frame[ sizeof( Header ) ];
+
+  std::memcpy( pData, &Record, sizeof( Record ) );
+  pData += sizeof( Record );
+
+  std::memcpy( pData, pEvent->GetcX(), CoefsSize );
+  pData += CoefsSize;
+
+  std::memcpy( pData, pEvent->GetcY(), CoefsSize );
+  pData += CoefsSize;
+
+  std::memcpy( pData, pEvent->GetcZ(), CoefsSize );
+  pData += CoefsSize;
+
+  std::memcpy( pData, AsteroidName.data(), Record.NameLength );
+
+  Header.Descriptor = LOAbsEventDataIO :: Descriptor;
+  Header.Size       = static_cast<int>( Size );
+  Header.Checksum   = apslib::APSHash( &Frame[ sizeof( Header ) ], Size );
+
+  std::memcpy( &Frame[ 0 ], &Header, sizeof( Header ) );
+
+  if( !pOutputFile->PutRecord( &Frame[ 0 ], Frame.size() ) ) {
+    pModule->ErrorMessage( LO_EVENT_DATA_WRITER_EVENT );
+    RetCode = LO_EVENT_DATA_WRITER_EVENT;
+    return;
+  }
+
+  RecordsNumber++;
+
+  if( MaxOccDuration < Record.EndOccTime - Record.BeginOccTime ) {
+    MaxOccDuration = Record.EndOccTime - Record.BeginOccTime;
+  }
+
+  if( time( 0 ) - SyncTime >= SYNC_PERIOD ) {
+    if( !pOutputFile->Sync() ) {
+      pModule->WarningMessage( LO_EVENT_DATA_WRITER_SYNC );
+    }
+
+    SyncTime = time( 0 );
+  }
+}
+
+void LOStreamEventData :: Checkpoint( const LOCheckpoint & Checkpoint )
+{
+  LOCheckpointRecord Record;
+
+  if( CheckpointFileName.empty() || RetCode || !pOutputFile->IfOpened() ) {
+    return;
+  }
+
+  if( !pOutputFile->Sync() ) {
+    pModule->WarningMessage( LO_EVENT_DATA_WRITER_SYNC );
+    return;
+  }
+
+  SyncTime = time( 0 );
+
+  std::memset( &Record, 0, sizeof( Record ) );
+
+  Record.Descriptor           = LOAbsEventDataIO :: Descriptor;
+  Record.Version              = CHECKPOINT_VERSION;
+  Record.RecordsOffset        = RecordsOffset;
+  Record.StreamOffset         = pOutputFile->Pos();
+  Record.MaxOccDuration       = MaxOccDuration;
+  Record.ElongationCulledDays = Checkpoint.ElongationCulledDays;
+  Record.RecordsNumber        = RecordsNumber;
+  Record.AsteroidIndex        = Checkpoint.AsteroidIndex;
+  Record.AsteroidID           = Checkpoint.AsteroidID;
+  Record.SQLNumber            = Checkpoint.SQLNumber;
+  Record.SiteRejectedEvents   = Checkpoint.SiteRejectedEvents;
+  Record.Checksum             = apslib::APSHash( &Record, offsetof( LOCheckpointRecord, Checksum ) );
+
+  if( !WriteCheckpoint( Record ) ) {
+    std::ostringstream Msg;
+    Msg << CheckpointFileName << std::endl;
+    pModule->WarningMessage( LO_EVENT_DATA_WRITER_CHECKPOINT, Msg.str() );
+  }
+}
+
+int LOStreamEventData :: Close( void )
+{
+  if( !pOutputFile->IfOpened() ) {
+    return( RetCode );
+  }
+
+  if( !RetCode ) {
+    if( WriteFooter() && pOutputFile->Sync() ) {
+      std::ostringstream Msg;
+      Msg << RecordsNumber << " records." << std::endl;
+      pModule->InfoMessage( LO_EVENT_DATA_WRITER_FINISH_STREAM, Msg.str() );
+    }
+    else {
+      pModule->ErrorMessage( LO_EVENT_DATA_WRITER_EVENT );
+      RetCode = LO_EVENT_DATA_WRITER_EVENT;
+    }
+  }
+
+  pOutputFile->Close();
+
+  return( RetCode );
+}
+
+}}
+
+//---------------------------- End of file ---------------------------
@@ -0,0 +1,108 @@
+//------------------------------------------------------------------------------
+//
+// File:    loStreamEventData.h
+//
+// Purpose: Class for writing occultation events to the file while they are calculated.
+//   
+// (c) 2026 Plekhanov Andrey
+//
+// Initial version 0.1 19.10.2026
+//         version 0.2 19.10.2026 Resume and checkpoints
+// 
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+//
+//------------------------------------------------------------------------------
+
+#ifndef LO_STREAM_EVENT_DATA_H
+#define LO_STREAM_EVENT_DATA_H
+
+#include <string>
+#include <vector>
+#include <ctime>
+
+#include <stdint.h>
+
+#include "loAbsEventDataIO.h"
+#include "loEventSink.h"
+
+namespace aps {
+
+  namespace apslib {
+    class APSOSyncFile;
+  }
+
+  namespace apslinoccult {
+
+using apslib::APSOSyncFile;
+
+class LOEvent;
+class LOEventDataWriterSubModule;
+class LOModuleEventDataWriter;
+
+//======================= LOStreamEventData ==========================
+
+class LOStreamEventData : public LOAbsEventDataIO, public LOEventSink
+{
+  private:
+
+    LOModuleEventDataWriter * pModule;
+    APSOSyncFile            * pOutputFile;
+    std::string               CheckpointFileName;
+    std::vector<char>         Frame;
+    int64_t                   RecordsOffset;
+    int                       RecordsNumber;
+    double                    MaxOccDuration;
+    time_t                    SyncTime;
+    int                       RetCode;
+
+    bool WriteHeader( void );
+
+    bool WriteAlignment( void );
+
+    bool WriteFooter( void );
+
+    bool ReadCheckpoint( LOCheckpointRecord & Record ) const;
+
+    bool WriteCheckpoint( const LOCheckpointRecord & Record ) const;
+
+  public:
+
+    /* Checkpoints are not written if CheckpointFileName is empty */
+    LOStreamEventData( LOEventDataWriterSubModule * pLOEventDataWriterSubModule, const std::string & EventDataFileName,
+                       const std::string & aCheckpointFileName );
+
+    virtual ~LOStreamEventData( void );
+
+    /* Creates the file and writes its header */
+    int Open( void );
+
+    /* Opens the file written before, frames after the checkpoint are removed */
+    int Resume( LOCheckpoint & Checkpoint );
+
+    /* Appends the event frame, the file is synchronized with the disk from time to time */
+    virtual void PutEvent( const LOEvent * pEvent );
+
+    /* Stream is synchronized with the disk, then the checkpoint file is replaced */
+    virtual void Checkpoint( const LOCheckpoint & Checkpoint );
+
+    /* Writes the footer, returns the first error of the stream */
+    int Close( void );
+};
+
+}}
+
+#endif
+
+//---------------------------- End of file ---------------------------
@@ -8,6 +8,9 @@
 //
 // Initial version 0.1 28.12.2004
 //         version 0.2 13.02.2005 Storing events
+//         version 0.3 19.10.2026 FILE_VERSION_2 block writing
+//         version 0.4 19.10.2026 Only events of the date interval are visited
+//         version 0.5 19.10.2026 Record fields are set by SetRecord
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -27,6 +30,7 @@
 
 #include <sstream>
 #include <iomanip>
+#include <cstring>
 
 #include "apsobinfile.h"
 #include "apsmodule.h"
@@ -60,12 +64,11 @@ LOWriteEventData :: ~LOWriteEventData( void )
   delete pOutputFile;
 }
 
-bool LOWriteEventData :: WriteHeader( LOEventData * pLOEventData ) const
+bool LOWriteEventData :: WriteHeader( void ) const
 {
   const apslib::APSMainModule * pMainModule;
   int                           Version;
   int                           Length;
-  int                           RecordsNumber;
   std::string                   ProgramName;
   bool                          RetCode;
 
@@ -84,15 +87,9 @@ bool LOWriteEventData :: WriteHeader( LOEventData * pLOEventData ) const
       RetCode = pOutputFile->PutRecord( ProgramName.c_str(), Length );
 
       if( RetCode ) {
-        Version = FILE_VERSION_1; /* File version */
+        Version = FILE_VERSION_2; /* File version */
 
         RetCode = pOutputFile->PutRecord( &Version, sizeof( Version ) );
-
-        if( RetCode ) {
-          RecordsNumber = pLOEventData->GetEventsNumber();
-
-          RetCode = pOutputFile->PutRecord( &RecordsNumber, sizeof( RecordsNumber ) );
-        }
       }
     }
   }
@@ -100,324 +97,140 @@ bool LOWriteEventData :: WriteHeader( LOEventData * pLOEventData ) const
   return( RetCode );
 }
 
-bool LOWriteEventData :: WriteEvent( LOEvent * pEvent, int & Count, const double MjdStart, const double MjdEnd ) const
+void LOWriteEventData :: AddEvent( const LOEvent * pEvent, std::vector<LOEventRecord> & Records,
+                                   std::vector<double> & Coefs, std::string & Names,
+                                   std::map<std::string,int> & NameOffsets ) const
 {
-  int            i;
-  int            AsteroidID;
-  std::string    AsteroidName;
-  double         Diameter;
-  double         EphemerisUncertainty;
-  double         ObservationEpoch;
-  double         M;
-  double         W;
-  double         O;
-  double         I;
-  double         E;
-  double         A;
-  unsigned char  Catalog;
-  int            StarNumber;
-  short          Mv;
-  short          ChebOrder;
-  const double * cX;
-  const double * cY;
-  const double * cZ;
-  double         ET_UT;
-  double         BeginOccTime;
-  double         EndOccTime;
-  int            EarthFlag;
-  double         MaxDuration;
-  double         StarRA;
-  double         StarDec;
-  double         MoonPhase;
-  double         SunDist;
-  double         MoonDist;
-  double         Brightness;
-  double         BrightDelta;
-  double         Uncertainty;
-  int            Length;
-
-  if( IfInInterval( MjdStart, MjdEnd, pEvent->GetBeginOccTime(), pEvent->GetEndOccTime() ) ) {
-
-    //---------------- AsteroidID -----------------
-
-    AsteroidID = pEvent->GetAsteroidID();
-
-    if( !pOutputFile->PutRecord( &AsteroidID, sizeof( AsteroidID ) ) ) {
-      return( false );
-    }
-
-    //---------------- AsteroidName -----------------
-
-    AsteroidName = pEvent->GetAsteroidNamePtr();
-
-    Length = AsteroidName.length();
-
-    if( !pOutputFile->PutRecord( &Length, sizeof( Length ) ) ) {
-      return( false );
-    }
-
-    if( !pOutputFile->PutRecord( AsteroidName.c_str(), Length ) ) {
-      return( false );
-    }
-
-    //---------------- Diameter -----------------
-
-    Diameter = pEvent->GetDiameter();
-
-    if( !pOutputFile->PutRecord( &Diameter, sizeof( Diameter ) ) ) {
-      return( false );
-    }
-
-    //---------------- EphemerisUncertainty -----------------
-
-    EphemerisUncertainty = pEvent->GetEphemerisUncertainty();
-
-    if( !pOutputFile->PutRecord( &EphemerisUncertainty, sizeof( EphemerisUncertainty ) ) ) {
-      return( false );
-    }
-
-    //---------------- ObservationEpoch -----------------
-
-    ObservationEpoch = pEvent->GetObservationEpoch();
-
-    if( !pOutputFile->PutRecord( &ObservationEpoch, sizeof( ObservationEpoch ) ) ) {
-      return( false );
-    }
-
-    //---------------- M -----------------
-
-    M = pEvent->GetM();
-
-    if( !pOutputFile->PutRecord( &M, sizeof( M ) ) ) {
-      return( false );
-    }
-
-    //---------------- W -----------------
-
-    W = pEvent->GetW();
-
-    if( !pOutputFile->PutRecord( &W, sizeof( W ) ) ) {
-      return( false );
-    }
-
-    //---------------- O -----------------
-
-    O = pEvent->GetO();
-
-    if( !pOutputFile->PutRecord( &O, sizeof( O ) ) ) {
-      return( false );
-    }
-
-    //---------------- I -----------------
-
-    I = pEvent->GetI();
-
-    if( !pOutputFile->PutRecord( &I, sizeof( I ) ) ) {
-      return( false );
-    }
-
-    //---------------- E -----------------
-
-    E = pEvent->GetE();
-
-    if( !pOutputFile->PutRecord( &E, sizeof( E ) ) ) {
-      return( false );
-    }
-
-    //---------------- A -----------------
-
-    A = pEvent->GetA();
-
-    if( !pOutputFile->PutRecord( &A, sizeof( A ) ) ) {
-      return( false );
-    }
-
-    //---------------- Catalog -----------------
-
-    Catalog = pEvent->GetCatalog();
-
-    if( !pOutputFile->PutRecord( &Catalog, sizeof( Catalog ) ) ) {
-      return( false );
-    }
-
-    //---------------- StarNumber -----------------
-
-    StarNumber = pEvent->GetStarNumber();
-
-    if( !pOutputFile->PutRecord( &StarNumber, sizeof( StarNumber ) ) ) {
-      return( false );
-    }
-
-    //---------------- Mv -----------------
-
-    Mv = pEvent->GetMv();
-
-    if( !pOutputFile->PutRecord( &Mv, sizeof( Mv ) ) ) {
-      return( false );
-    }
-
-    //---------------- ChebOrder -----------------
-
-    ChebOrder = pEvent->GetChebOrder();
+  LOEventRecord Record;
+  int           i;
 
-    if( !pOutputFile->PutRecord( &ChebOrder, sizeof( ChebOrder ) ) ) {
-      return( false );
-    }
-
-    //---------------- cX -----------------
-
-    cX = pEvent->GetcX();
-
-    for( i = 0; i <= ChebOrder; i++ ) {
-      if( !pOutputFile->PutRecord( &cX[ i ], sizeof( cX[ 0 ] ) ) ) {
-        return( false );
-      }
-    }
-
-    //---------------- cY -----------------
-
-    cY = pEvent->GetcY();
-
-    for( i = 0; i <= ChebOrder; i++ ) {
-      if( !pOutputFile->PutRecord( &cY[ i ], sizeof( cY[ 0 ] ) ) ) {
-        return( false );
-      }
-    }
-
-    //---------------- cZ -----------------
-
-    cZ = pEvent->GetcZ();
-
-    for( i = 0; i <= ChebOrder; i++ ) {
-      if( !pOutputFile->PutRecord( &cZ[ i ], sizeof( cZ[ 0 ] ) ) ) {
-        return( false );
-      }
-    }
-
-    //---------------- ET_UT -----------------
-
-    ET_UT = pEvent->GetET_UT();
-
-    if( !pOutputFile->PutRecord( &ET_UT, sizeof( ET_UT ) ) ) {
-      return( false );
-    }
-
-    //---------------- BeginOccTime -----------------
-
-    BeginOccTime = pEvent->GetBeginOccTime();
-
-    if( !pOutputFile->PutRecord( &BeginOccTime, sizeof( BeginOccTime ) ) ) {
-      return( false );
-    }
-
-    //---------------- EndOccTime -----------------
-
-    EndOccTime = pEvent->GetEndOccTime();
-
-    if( !pOutputFile->PutRecord( &EndOccTime, sizeof( EndOccTime ) ) ) {
-      return( false );
-    }
-
-    //---------------- EarthFlag -----------------
-
-    EarthFlag = pEvent->GetEarthFlag();
-
-    if( !pOutputFile->PutRecord( &EarthFlag, sizeof( EarthFlag ) ) ) {
-      return( false );
-    }
-
-    //---------------- MaxDuration -----------------
+  SetRecord( pEvent, Record );
 
-    MaxDuration = pEvent->GetMaxDuration();
+  const std::string AsteroidName = pEvent->GetAsteroidNamePtr();
 
-    if( !pOutputFile->PutRecord( &MaxDuration, sizeof( MaxDuration ) ) ) {
-      return( false );
-    }
-
-    //---------------- StarRA -----------------
+  std::map<std::string,int>::const_iterator p = NameOffsets.find( AsteroidName );
 
-    StarRA = pEvent->GetStarRA();
+  if( p == NameOffsets.end() ) {
+    Record.NameOffset = Names.length();
 
-    if( !pOutputFile->PutRecord( &StarRA, sizeof( StarRA ) ) ) {
-      return( false );
-    }
+    NameOffsets[ AsteroidName ] = Record.NameOffset;
 
-    //---------------- StarDec -----------------
+    Names += AsteroidName;
+  }
+  else {
+    Record.NameOffset = p->second;
+  }
 
-    StarDec = pEvent->GetStarDec();
+  Record.NameLength = AsteroidName.length();
+  Record.CoefOffset = Coefs.size();
 
-    if( !pOutputFile->PutRecord( &StarDec, sizeof( StarDec ) ) ) {
-      return( false );
-    }
+  for( i = 0; i <= Record.ChebOrder; i++ ) {
+    Coefs.push_back( pEvent->GetcX()[ i ] );
+  }
 
-    //---------------- MoonPhase -----------------
+  for( i = 0; i <= Record.ChebOrder; i++ ) {
+    Coefs.push_back( pEvent->GetcY()[ i ] );
+  }
 
-    MoonPhase = pEvent->GetMoonPhase();
+  for( i = 0; i <= Record.ChebOrder; i++ ) {
+    Coefs.push_back( pEvent->GetcZ()[ i ] );
+  }
 
-    if( !pOutputFile->PutRecord( &MoonPhase, sizeof( MoonPhase ) ) ) {
-      return( false );
-    }
+  Records.push_back( Record );
+}
 
-    //---------------- SunDist -----------------
+bool LOWriteEventData :: WriteAlignment( void ) const
+{
+  const char Zero[ EVENT_FILE_ALIGNMENT ] = { 0 };
+  int        Length;
 
-    SunDist = pEvent->GetSunDist();
+  Length = static_cast<int>( pOutputFile->Pos() % EVENT_FILE_ALIGNMENT );
 
-    if( !pOutputFile->PutRecord( &SunDist, sizeof( SunDist ) ) ) {
-      return( false );
-    }
+  if( Length ) {
+    return( pOutputFile->PutRecord( Zero, EVENT_FILE_ALIGNMENT - Length ) );
+  }
 
-    //---------------- MoonDist -----------------
+  return( true );
+}
 
-    MoonDist = pEvent->GetMoonDist();
+bool LOWriteEventData :: WriteBlocks( const std::vector<LOEventRecord> & Records,
+                                      const std::vector<double> & Coefs, const std::string & Names,
+                                      const double MaxOccDuration ) const
+{
+  LOEventFileFooter Footer;
 
-    if( !pOutputFile->PutRecord( &MoonDist, sizeof( MoonDist ) ) ) {
-      return( false );
-    }
+  std::memset( &Footer, 0, sizeof( Footer ) );
 
-    //---------------- Brightness -----------------
+  if( !WriteAlignment() ) {
+    return( false );
+  }
 
-    Brightness = pEvent->GetBrightness();
+  Footer.RecordsOffset = pOutputFile->Pos();
+  Footer.RecordsNumber = Records.size();
+  Footer.RecordSize    = sizeof( LOEventRecord );
 
-    if( !pOutputFile->PutRecord( &Brightness, sizeof( Brightness ) ) ) {
+  if( !Records.empty() ) {
+    if( !pOutputFile->PutRecord( &Records[ 0 ], Records.size() * sizeof( LOEventRecord ) ) ) {
       return( false );
     }
+  }
 
-    //---------------- BrightDelta -----------------
+  if( !WriteAlignment() ) {
+    return( false );
+  }
 
-    BrightDelta = pEvent->GetBrightDelta();
+  Footer.CoefOffset = pOutputFile->Pos();
+  Footer.CoefNumber = Coefs.size();
 
-    if( !pOutputFile->PutRecord( &BrightDelta, sizeof( BrightDelta ) ) ) {
+  if( !Coefs.empty() ) {
+    if( !pOutputFile->PutRecord( &Coefs[ 0 ], Coefs.size() * sizeof( double ) ) ) {
       return( false );
     }
+  }
 
-    //---------------- Uncertainty -----------------
+  if( !WriteAlignment() ) {
+    return( false );
+  }
 
-    Uncertainty = pEvent->GetUncertainty();
+  Footer.NamesOffset = pOutputFile->Pos();
+  Footer.NamesSize   = Names.length();
 
-    if( !pOutputFile->PutRecord( &Uncertainty, sizeof( Uncertainty ) ) ) {
+  if( !Names.empty() ) {
+    if( !pOutputFile->PutRecord( Names.data(), Names.length() ) ) {
       return( false );
     }
+  }
 
-    Count++;
+  if( !WriteAlignment() ) {
+    return( false );
   }
 
-  return( true );
+  Footer.MaxOccDuration = MaxOccDuration;
+  Footer.Flags          = EVENT_FILE_SORTED_BY_DATE;
+  Footer.Descriptor     = LOAbsEventDataIO :: Descriptor;
+
+  return( pOutputFile->PutRecord( &Footer, sizeof( Footer ) ) );
 }
 
 int LOWriteEventData :: Write( LOData * pLOData )
 {
-  unsigned int   i;
-  int            Count;
-  LOEventData  * pLOEventData;
-  LOEvent      * pEvent;
-  double         MjdStart;
-  double         MjdEnd;
-  int            RetCode = LO_EVENT_DATA_WRITER_NO_ERROR;
+  unsigned int               i;
+  unsigned int               First;
+  unsigned int               Last;
+  LOEventData              * pLOEventData;
+  const LOEvent            * pEvent;
+  double                     MjdStart;
+  double                     MjdEnd;
+  std::vector<LOEventRecord> Records;
+  std::vector<double>        Coefs;
+  std::string                Names;
+  std::map<std::string,int>  NameOffsets;
+  int                        RetCode = LO_EVENT_DATA_WRITER_NO_ERROR;
 
   pLOEventData = pLOData->GetEventDataPtr();
 
   if( pOutputFile->Open() ) {
-    if( WriteHeader( pLOEventData ) ) {
+    if( WriteHeader() ) {
       {
       std::ostringstream Msg;
       Msg << pLOEventData->GetEventsNumber() << " records. Start data " << pModule->GetStartYear() <<
@@ -433,30 +246,32 @@ int LOWriteEventData :: Write( LOData * pLOData )
       MjdStart = apsastroalg::Mjd( pModule->GetStartYear(), pModule->GetStartMonth(), pModule->GetStartDay() );
       MjdEnd = apsastroalg::Mjd( pModule->GetEndYear(), pModule->GetEndMonth(), pModule->GetEndDay() ) + 1.0;
 
-      Count = 0;
+      pLOEventData->FindEventsByDate( MjdStart, MjdEnd, First, Last );
 
-      for( i = 0; i < pLOEventData->GetEventsNumber(); i++ ) {
-        pEvent = pLOEventData->GetEventPtr( i );
+      Records.reserve( Last - First );
 
-        RetCode = WriteEvent( pEvent, Count, MjdStart, MjdEnd );
+      for( i = First; i < Last; i++ ) {
+        pEvent = pLOEventData->GetEventPtr( i );
 
-        if( !RetCode ) {
-          pModule->ErrorMessage( LO_EVENT_DATA_WRITER_EVENT );
-          RetCode = LO_EVENT_DATA_WRITER_EVENT;
-          break;
+        if( IfInInterval( MjdStart, MjdEnd, pEvent->GetBeginOccTime(), pEvent->GetEndOccTime() ) ) {
+          AddEvent( pEvent, Records, Coefs, Names, NameOffsets );
         }
 
-        if( !( i % SHOW_EVENT_NUMBER ) ) {
+        if( !( ( i - First ) % SHOW_EVENT_NUMBER ) ) {
           pModule->StrMessage( LO_EVENT_DATA_WRITER_PROGRESS );
         }
       }
 
       pModule->StrMessage( LO_EVENT_DATA_WRITER_NEW_LINE );
 
-      {
-      std::ostringstream Msg;
-      Msg << Count << " records." << std::endl;
-      pModule->InfoMessage( LO_EVENT_DATA_WRITER_FINISH_WRITING, Msg.str() );
+      if( WriteBlocks( Records, Coefs, Names, pLOEventData->GetMaxOccDuration() ) ) {
+        std::ostringstream Msg;
+        Msg << Records.size() << " records." << std::endl;
+        pModule->InfoMessage( LO_EVENT_DATA_WRITER_FINISH_WRITING, Msg.str() );
+      }
+      else {
+        pModule->ErrorMessage( LO_EVENT_DATA_WRITER_EVENT );
+        RetCode = LO_EVENT_DATA_WRITER_EVENT;
       }
     }
     else {
@@ -8,6 +8,8 @@
 //
 // Initial version 0.1 28.12.2004
 //         version 0.2 13.02.2005 Storing events
+//         version 0.3 19.10.2026 FILE_VERSION_2 block writing
+//         version 0.4 19.10.2026 Only events of the date interval are visited
 // 
 // This program is free software; you can redistribute it and/or
 // modify it under the terms of the GNU General Public License
@@ -29,6 +31,8 @@
 #define LO_WRITE_EVENT_DATA_H
 
 #include <string>
+#include <vector>
+#include <map>
 
 #include "loAbsEventDataIO.h"
 
@@ -56,9 +60,17 @@ class LOWriteEventData : public LOAbsEventDataIO
     LOModuleEventDataWriter * pModule;
     APSOBinFile             * pOutputFile;
 
-    bool WriteHeader( LOEventData * pLOEventData ) const;
+    bool WriteHeader( void ) const;
 
-    bool WriteEvent( LOEvent * pEvent, int & Count, const double MjdStart, const double MjdEnd ) const;
+    void AddEvent( const LOEvent * pEvent, std::vector<LOEventRecord> & Records,
+                   std::vector<double> & Coefs, std::string & Names,
+                   std::map<std::string,int> & NameOffsets ) const;
+
+    bool WriteAlignment( void ) const;
+
+    bool WriteBlocks( const std::vector<LOEventRecord> & Records,
+                      const std::vector<double> & Coefs, const std::string & Names,
+                      const double MaxOccDuration ) const;
 
   public:
 